@@ -7,6 +7,7 @@
  * @copyright GNU Lesser General Public License v3.0
  */
 
+#include <inttypes.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -15,20 +16,6 @@
 #include "csp.h"
 #include "util/unused.h"
 
-// Check if the queens are compatible
-bool queen_compatibles(CSPConstraint *constraint, const size_t *values,
-	unsigned int *UNUSED_VAR(data)
-){
-	// Get the variables
-	size_t x0 = csp_constraint_get_variable(constraint, 0);
-	size_t x1 = csp_constraint_get_variable(constraint, 1);
-	// Get the values
-	size_t y0 = values[x0];
-	size_t y1 = values[x1];
-	// Check if the queens are compatible
-	return /* x0 != x1 && */ y0 != y1 && x0 + y1 != x1 + y0 && x0 + y0 != x1 + y1;
-}
-
 // Print the solution
 static void print_queens_solution(unsigned int number, const size_t *queens) {
 	printf("┌");
@@ -60,25 +47,6 @@ static void print_queens_solution(unsigned int number, const size_t *queens) {
 	printf("───┘\n");
 }
 
-void queens_checklist(const CSPProblem *csp, CSPConstraint **checklist,
-	size_t *amount, const size_t index, FilledVariables *fv
-){
-	size_t num_queens = csp_problem_get_num_domains(csp);
-	*amount = 0;
-	size_t next = filled_variables_next_filled(fv, 0);
-	while (next != SIZE_MAX) {
-		if (next < index) {
-			checklist[(*amount)++] = csp_problem_get_constraint(
-				csp,next * num_queens - next*(next+1)/2 + (index - next) - 1);
-		}
-		if (next > index) {
-			checklist[(*amount)++] = csp_problem_get_constraint(
-				csp,index*num_queens - index*(index+1)/2 + (next - index) - 1);
-		}
-		next = filled_variables_next_filled(fv, next + 1);
-	}
-}
-
 int solve_queens(size_t queen_count, const char *resultFile,
 								 SolveType solve_type, bool silent) {
 	// Initialise the library
@@ -116,37 +84,39 @@ int solve_queens(size_t queen_count, const char *resultFile,
 				// arity is 2 because we are checking compatibility between two
 				// queens
 				csp_problem_set_constraint(problem, index,
-					csp_constraint_create(2, (CSPChecker *)queen_compatibles)
-				);
-				csp_constraint_set_variable(
-					csp_problem_get_constraint(problem, index), 0, i
-				);
-				csp_constraint_set_variable(
-					csp_problem_get_constraint(problem, index), 1, j
+					csp_constraint_create_queens(i, j)
 				);
 				index++;
 			}
 		}
+		if (!csp_problem_finalise(problem)) {
+			fprintf(stderr, "csp_problem_finalise failed\n");
+			while (index--) {
+				csp_constraint_destroy(csp_problem_get_constraint(problem, index));
+			}
+			csp_problem_destroy(problem);
+			free(queens);
+			csp_finish();
+			return EXIT_FAILURE;
+		}
 
 		FILE *file = fopen(resultFile, "a");
-		size_t* backtrack_counter = malloc(sizeof(size_t));
+		CSPSolveStats stats;
 
 		// Start the timer
 		clock_t start_time = clock();
 
 		bool result = csp_problem_solve(problem, queens, NULL, solve_type,
-			queens_checklist, NULL, backtrack_counter
+			NULL, NULL, &stats
 		);
 
 		// Stop the timer
 		clock_t end_time = clock();
 		double time_spent = (double)(end_time - start_time) / CLOCKS_PER_SEC;
-		fprintf(file, "%f %zu\n", time_spent, *backtrack_counter);
+		fprintf(file, "%f %" PRIu64 "\n", time_spent, stats.nodes);
 
 		fclose(file);
 
-		free(backtrack_counter);
-
 		// Destroy the CSP problem
 		while (index--) {
 			csp_constraint_destroy(csp_problem_get_constraint(problem, index));
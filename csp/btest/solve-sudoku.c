@@ -8,6 +8,7 @@
  */
 
 #include <assert.h>
+#include <inttypes.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -17,8 +18,6 @@
 #include "csp.h"
 #include "util/unused.h"
 
-static size_t backtrack_counter = 0;
-
 /**
  * Merges the values of the unknowns with the starter grid to create a solved
  * grid. Used solely for printing the solution at the end
@@ -74,13 +73,6 @@ typedef struct {
 	size_t y;			 // y coordinate of the unknown in the starter grid
 } Unknown;
 
-typedef struct {
-	size_t count;
-	size_t index;
-} Location;
-
-static Location* locations;
-
 /**
  * Fills the unknown_positions array with the positions of the unknowns in the
  * grid.
@@ -134,117 +126,34 @@ static size_t get_constraining_unknowns(const Unknown *unknown_positions,
 	return constraining_unknown_count;
 }
 
-void sudoku_unknown_checklist(const CSPProblem *csp, CSPConstraint **checklist,
-	size_t *amount, const size_t index, FilledVariables *fv
-){
-	size_t next = filled_variables_next_filled(fv, 0);
-	while (next != SIZE_MAX) {
-		if (next < index) {
-			for (size_t i = 0; i < locations[next].count; i++) {
-				size_t current_index = locations[next].index + i;
-				CSPConstraint *constraint = csp_problem_get_constraint(csp,
-					current_index
-				);
-				if (csp_constraint_get_variable(constraint, 1) == index) {
-					checklist[(*amount)++] = constraint;
-				}
-			}
-		} else if (next > index) {
-			for (size_t i = 0; i < locations[index].count; i++) {
-				size_t current_index = locations[index].index + i;
-				CSPConstraint *constraint = csp_problem_get_constraint(csp,
-					current_index
-				);
-				if (csp_constraint_get_variable(constraint, 1) == next) {
-					checklist[(*amount)++] = constraint;
-				}
-			}
-		}
-		next = filled_variables_next_filled(fv, next + 1);
-	}
-}
-
-void sudoku_data_checklist(const CSPProblem *csp, CSPConstraint **checklist,
-	size_t *amount, const size_t index
-){
-	*amount = 1;
-	checklist[0] = csp_problem_get_constraint(csp, index);
-}
-
-bool unknown_checker(const CSPConstraint *constraint, const size_t *values,
-										 const void *UNUSED_VAR(data)) {
-	size_t unknown1 = values[csp_constraint_get_variable(constraint, 0)];
-	size_t unknown2 = values[csp_constraint_get_variable(constraint, 1)];
-	return unknown1 != unknown2;
-}
+/**
+ * Store the data given to the data constraints
+ */
+typedef struct {
+	const size_t *grid;				// starter grid of the sudoku, 0s are unknowns
+	const Unknown *unknowns;	// positions of the unknowns in the starter grid
+} SudokuData;
 
 bool data_checker(const CSPConstraint *constraint, const size_t *values,
 									const void *data) {
-	// csp_constraint_get_variable(constraint, csp_constraint_get_arity()-1) is
-	// the coordinate of the unknown cell itself in the unknown list
-	// csp_constraint_get_variable(constraint, i) is the coordinate of a cell in
-	// the grid that is in the row, column or box of the unknown cell if it is
-	// <81 if it is >=81, it corresponds to it's index with values
-	size_t *grid = (size_t *)data;
-	const size_t arity = csp_constraint_get_arity(constraint);
-	const size_t current_unknown =
-			csp_constraint_get_variable(constraint, arity - 1);
-	for (size_t i = 0; i < arity - 1;
-			 i++) {	 // arity-1 because the last variable is the unknown cell itself
-		const size_t variable = csp_constraint_get_variable(constraint, i);
-		if (variable < 81) {
-			if (grid[variable] - 1 == values[current_unknown]) {
-				return false;
-			}
-		} else if (values[variable - 81] == values[current_unknown]) {
-			return false;
-		}
-	}
-	return true;
-	;
-}
-
-static CSPConstraint *create_data_constraint(size_t constraint_index,
-	const Unknown *unknown_positions, const size_t *starter_grid
-){
-	size_t variables[21];
-	const size_t x = unknown_positions[constraint_index].x;
-	const size_t y = unknown_positions[constraint_index].y;
-	size_t constraint_arity_index = 0;
+	// csp_constraint_get_variable(constraint, 0) is the index of the unknown
+	// cell in the unknown list, whose position was computed once for all
+	const SudokuData *sudoku = (const SudokuData *)data;
+	const size_t unknown = csp_constraint_get_variable(constraint, 0);
+	const size_t x = sudoku->unknowns[unknown].x;
+	const size_t y = sudoku->unknowns[unknown].y;
+	const size_t *grid = sudoku->grid;
 
 	for (size_t i = 0; i < 9; i++) {
-		if (starter_grid[i * 9 + x] != 0) {
-			variables[constraint_arity_index] = i * 9 + x;	// column
-			constraint_arity_index++;
-		}
-		if (starter_grid[y * 9 + i] != 0) {
-			variables[constraint_arity_index] = y * 9 + i;	// row
-			constraint_arity_index++;
-		}
-	}
-
-	for (size_t i = 0; i < 3; i++) {
-		for (size_t j = 0; j < 3; j++) {
-			if(!(x % 3 == i || y % 3 == j) /*not already added earlier*/
-				&& starter_grid[x - x % 3 + (y - y % 3) * 9 + i + j * 9] != 0
-			){
-				variables[constraint_arity_index] = x - x % 3 + (y - y % 3) * 9 + i + j * 9;	// box
-				constraint_arity_index++;
-			}
+		if (grid[y * 9 + i] == values[unknown] + 1 /*row*/
+			|| grid[i * 9 + x] == values[unknown] + 1 /*column*/
+			|| grid[(y - y % 3 + i / 3) * 9 + x - x % 3 + i % 3]
+				== values[unknown] + 1 /*box*/
+		) {
+			return false;
 		}
 	}
-
-	CSPConstraint *constraint = csp_constraint_create(
-		constraint_arity_index + 1, data_checker
-	);
-	for (size_t i = 0; i < constraint_arity_index; i++) {
-		csp_constraint_set_variable(constraint, i, variables[i]);
-	}
-	// the last variable is the unknown cell itself, so the checker function can
-	// use it for its logic
-	csp_constraint_set_variable(constraint, constraint_arity_index,
-															constraint_index);
-	return constraint;
+	return true;
 }
 
 int solve_sudoku(const size_t *starter_grid, const char *resultFile,
@@ -287,18 +196,20 @@ int solve_sudoku(const size_t *starter_grid, const char *resultFile,
 		}
 
 		CSPConstraint *data_constraints[unknown_count];
-		// for each unknown, create a data constraint
+		// for each unknown, create a unary data constraint
 		for (size_t constraint_index = 0; constraint_index < unknown_count;
 				 constraint_index++) {
-			data_constraints[constraint_index] = create_data_constraint(
-					constraint_index, unknown_positions, starter_grid);
+			data_constraints[constraint_index] = csp_constraint_create(1,
+				data_checker
+			);
+			csp_constraint_set_variable(data_constraints[constraint_index], 0,
+				constraint_index
+			);
 		}
 
 		CSPConstraint *unknown_constraints[unknown_count * 20];
 		size_t total_unknown_constraints = 0;
 
-		locations = malloc(unknown_count * sizeof(Location));
-
 		// for each unknown, create constraints with all other affected unknowns
 		for (size_t unknown_index = 0; unknown_index < unknown_count;
 				 unknown_index++) {
@@ -306,17 +217,11 @@ int solve_sudoku(const size_t *starter_grid, const char *resultFile,
 				unknown_positions, unknown_index, unknown_count,
 				constraining_unknowns
 			);
-			locations[unknown_index].count = constraining_unknown_count;
-			locations[unknown_index].index = unknown_count + total_unknown_constraints;
 			total_unknown_constraints += constraining_unknown_count;
 
 			for (size_t i = 0; i < constraining_unknown_count; i++) {
-				CSPConstraint *constraint = csp_constraint_create(2,
-					unknown_checker
-				);
-				csp_constraint_set_variable(constraint, 0, unknown_index);
-				csp_constraint_set_variable(constraint, 1,
-					constraining_unknowns[i].index
+				CSPConstraint *constraint = csp_constraint_create_not_equal(
+					unknown_index, constraining_unknowns[i].index
 				);
 				unknown_constraints[
 					total_unknown_constraints - constraining_unknown_count + i
@@ -338,22 +243,36 @@ int solve_sudoku(const size_t *starter_grid, const char *resultFile,
 				unknown_constraints[i]
 			);
 		}
+		if (!csp_problem_finalise(problem)) {
+			fprintf(stderr, "csp_problem_finalise failed\n");
+			for (size_t index = 0; index < csp_problem_get_num_constraints(problem);
+					 index++) {
+				csp_constraint_destroy(csp_problem_get_constraint(problem, index));
+			}
+			csp_problem_destroy(problem);
+			free(unknown_positions);
+			free(unknowns);
+			csp_finish();
+			return EXIT_FAILURE;
+		}
+		const SudokuData data = {starter_grid, unknown_positions};
 
 		FILE *file = fopen(resultFile, "a");
+		CSPSolveStats stats;
 
 		// Start the timer
 		clock_t start_time = clock();
 
 		// Solve the CSP problem
 		bool result = csp_problem_solve(problem, unknowns,
-			starter_grid, solve_type,
-			sudoku_unknown_checklist, sudoku_data_checklist, &backtrack_counter
+			&data, solve_type,
+			NULL, NULL, &stats
 		);
 
 		// Stop the timer
 		clock_t end_time = clock();
 		double time_spent = (double)(end_time - start_time) / CLOCKS_PER_SEC;
-		fprintf(file, "%f %zu\n", time_spent, backtrack_counter);
+		fprintf(file, "%f %" PRIu64 "\n", time_spent, stats.nodes);
 
 		fclose(file);
 
@@ -381,7 +300,6 @@ int solve_sudoku(const size_t *starter_grid, const char *resultFile,
 
 		free(unknown_positions);
 		free(unknowns);
-		free(locations);
 
 		// Finish the library
 		csp_finish();
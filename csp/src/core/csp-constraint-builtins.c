@@ -0,0 +1,178 @@
+/**
+ * @file csp-constraint-builtins.c
+ * Defines the built-in binary constraints, which filter a whole domain at once.
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#include "core/csp-constraint-builtins.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "core/csp-constraint.h"
+#include "core/csp-lib.h"
+#include "util/unused.h"
+
+#include "core/csp-constraint.inc.h"
+
+// PRIVATE
+// Keep the bits of a set standing for the values in [low, high)
+static void keep_range(size_t base, const uint64_t *words, size_t num_words,
+	uint64_t *keep, size_t low, size_t high
+){
+	// Whole words are kept or cleared, only the words of the bounds are masked
+	for (size_t w = 0; w < num_words; w++) {
+		size_t first = base + w * 64;
+		uint64_t mask = UINT64_MAX;
+
+		if (low >= first + 64 || high <= first) {
+			mask = 0;
+		} else {
+			if (low > first) {
+				mask &= UINT64_MAX << (low - first);
+			}
+			if (high < first + 64) {
+				mask &= ((uint64_t) 1 << (high - first)) - 1;
+			}
+		}
+		keep[w] = words[w] & mask;
+	}
+}
+
+// Keep the bits of a set but the one standing for a value
+static void keep_all_but(size_t base, const uint64_t *words, size_t num_words,
+	uint64_t *keep, size_t value
+){
+	for (size_t w = 0; w < num_words; w++) {
+		keep[w] = words[w];
+	}
+	if (value >= base && value - base < num_words * 64) {
+		keep[(value - base) / 64] &= ~((uint64_t) 1 << (value - base) % 64);
+	}
+}
+
+// Get the other variable of a binary constraint
+static size_t builtin_other(const CSPConstraint *constraint, size_t variable){
+	return constraint->variables[0] == variable
+		? constraint->variables[1] : constraint->variables[0];
+}
+
+// Check that the difference of the values is not the constant
+static bool not_difference_check(const CSPConstraint *constraint,
+	const size_t *values, const void *UNUSED_VAR(data)
+){
+	return (ptrdiff_t) values[constraint->variables[0]]
+		- (ptrdiff_t) values[constraint->variables[1]] != constraint->constant;
+}
+// Keep the values not differing from the other one by the constant
+static void not_difference_domain_check(const CSPConstraint *constraint,
+	const size_t *values, const void *UNUSED_VAR(data), size_t variable,
+	size_t base, const uint64_t *words, size_t num_words, uint64_t *keep
+){
+	ptrdiff_t other = (ptrdiff_t) values[builtin_other(constraint, variable)];
+	ptrdiff_t forbidden = variable == constraint->variables[0]
+		? other + constraint->constant : other - constraint->constant;
+
+	if (forbidden < 0) {
+		keep_range(base, words, num_words, keep, 0, SIZE_MAX);
+	} else {
+		keep_all_but(base, words, num_words, keep, (size_t) forbidden);
+	}
+}
+
+// Check that the queens attack each other neither on a row nor on a diagonal
+static bool queens_check(const CSPConstraint *constraint,
+	const size_t *values, const void *UNUSED_VAR(data)
+){
+	size_t x0 = constraint->variables[0];
+	size_t x1 = constraint->variables[1];
+	size_t y0 = values[x0];
+	size_t y1 = values[x1];
+
+	return y0 != y1 && x0 + y1 != x1 + y0 && x0 + y0 != x1 + y1;
+}
+// Keep the rows the other queen does not attack
+static void queens_domain_check(const CSPConstraint *constraint,
+	const size_t *values, const void *UNUSED_VAR(data), size_t variable,
+	size_t base, const uint64_t *words, size_t num_words, uint64_t *keep
+){
+	size_t other = builtin_other(constraint, variable);
+	size_t distance = other > variable ? other - variable : variable - other;
+	size_t row = values[other];
+
+	// The other queen attacks its row and a row on each of its diagonals
+	keep_all_but(base, words, num_words, keep, row);
+	keep_all_but(base, keep, num_words, keep, row + distance);
+	if (row >= distance) {
+		keep_all_but(base, keep, num_words, keep, row - distance);
+	}
+}
+
+// Check that the first value is lower than the second one plus the constant
+static bool less_check(const CSPConstraint *constraint,
+	const size_t *values, const void *UNUSED_VAR(data)
+){
+	return values[constraint->variables[0]]
+		< values[constraint->variables[1]] + (size_t) constraint->constant;
+}
+// Keep the values ordered with the other one
+static void less_domain_check(const CSPConstraint *constraint,
+	const size_t *values, const void *UNUSED_VAR(data), size_t variable,
+	size_t base, const uint64_t *words, size_t num_words, uint64_t *keep
+){
+	size_t other = values[builtin_other(constraint, variable)];
+	// The constant is 1 if the values may be equal, 0 otherwise
+	size_t equal = (size_t) constraint->constant;
+
+	if (variable == constraint->variables[0]) {
+		keep_range(base, words, num_words, keep, 0, other + equal);
+	} else {
+		keep_range(base, words, num_words, keep, other + 1 - equal, SIZE_MAX);
+	}
+}
+
+// Create a built-in binary constraint
+static CSPConstraint *builtin_create(size_t x, size_t y, ptrdiff_t constant,
+	CSPChecker *check, CSPDomainChecker *domain_check
+){
+	assert(x != y);
+
+	CSPConstraint *constraint = csp_constraint_create(2, check);
+	if (constraint != NULL) {
+		constraint->variables[0] = x;
+		constraint->variables[1] = y;
+		constraint->constant = constant;
+		constraint->domain_check = domain_check;
+	}
+
+	return constraint;
+}
+
+// PUBLIC
+// Constructors
+CSPConstraint *csp_constraint_create_not_equal(size_t x, size_t y){
+	return builtin_create(x, y, 0, not_difference_check,
+		not_difference_domain_check
+	);
+}
+CSPConstraint *csp_constraint_create_not_difference(size_t x, size_t y,
+	ptrdiff_t k
+){
+	return builtin_create(x, y, k, not_difference_check,
+		not_difference_domain_check
+	);
+}
+CSPConstraint *csp_constraint_create_queens(size_t x, size_t y){
+	return builtin_create(x, y, 0, queens_check, queens_domain_check);
+}
+CSPConstraint *csp_constraint_create_less(size_t x, size_t y){
+	return builtin_create(x, y, 0, less_check, less_domain_check);
+}
+CSPConstraint *csp_constraint_create_less_equal(size_t x, size_t y){
+	return builtin_create(x, y, 1, less_check, less_domain_check);
+}
@@ -0,0 +1,78 @@
+/**
+ * @file csp-constraint-builtins.h
+ * Defines the built-in binary constraints, which filter a whole domain at once.
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#pragma once
+
+#if !defined (_CSP_H_INSIDE) && !defined (CSP_COMPILATION)
+#error "Only <csp/csp.h> can be included directly."
+#endif
+
+#include <stddef.h>
+
+#include "core/csp-constraint.h"
+
+// CONSTRUCTORS
+/**
+ * @brief Create a constraint whose variables take different values.
+ * @param x The first variable.
+ * @param y The second variable.
+ * @return The constraint created or NULL if an error occurred.
+ * @pre The csp library is initialised.
+ * @pre x != y
+ * @post The constraint has a check function and a domain check function.
+ */
+extern CSPConstraint *csp_constraint_create_not_equal(size_t x, size_t y);
+/**
+ * @brief Create a constraint whose variables differ by anything but a
+ * constant, the value of x minus the value of y not being k.
+ * @param x The first variable.
+ * @param y The second variable.
+ * @param k The forbidden difference.
+ * @return The constraint created or NULL if an error occurred.
+ * @pre The csp library is initialised.
+ * @pre x != y
+ * @post The constraint has a check function and a domain check function.
+ */
+extern CSPConstraint *csp_constraint_create_not_difference(size_t x, size_t y,
+	ptrdiff_t k
+);
+/**
+ * @brief Create a constraint between the queens of two columns, the variables
+ * being the columns and their values the rows, which attack each other neither
+ * on a row nor on a diagonal.
+ * @param x The column of the first queen.
+ * @param y The column of the second queen.
+ * @return The constraint created or NULL if an error occurred.
+ * @pre The csp library is initialised.
+ * @pre x != y
+ * @post The constraint has a check function and a domain check function.
+ */
+extern CSPConstraint *csp_constraint_create_queens(size_t x, size_t y);
+/**
+ * @brief Create a constraint whose first variable takes a value lower than the
+ * value of the second one.
+ * @param x The first variable.
+ * @param y The second variable.
+ * @return The constraint created or NULL if an error occurred.
+ * @pre The csp library is initialised.
+ * @pre x != y
+ * @post The constraint has a check function and a domain check function.
+ */
+extern CSPConstraint *csp_constraint_create_less(size_t x, size_t y);
+/**
+ * @brief Create a constraint whose first variable takes a value lower than or
+ * equal to the value of the second one.
+ * @param x The first variable.
+ * @param y The second variable.
+ * @return The constraint created or NULL if an error occurred.
+ * @pre The csp library is initialised.
+ * @pre x != y
+ * @post The constraint has a check function and a domain check function.
+ */
+extern CSPConstraint *csp_constraint_create_less_equal(size_t x, size_t y);
@@ -0,0 +1,217 @@
+/**
+ * @file csp-constraint-table.c
+ * Defines the table constraints, given by the list of their allowed or
+ * forbidden tuples.
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#include "core/csp-constraint-table.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "core/csp-constraint.h"
+#include "core/csp-lib.h"
+#include "util/bits.h"
+#include "util/unused.h"
+
+#include "core/csp-constraint.inc.h"
+
+// Number of words of the tuples matched at once by the domain check function
+#define TABLE_MATCH_WORDS 64
+
+// PRIVATE
+// Get the set of the tuples in which the variable at an index takes a value,
+// NULL if there is none
+static const uint64_t *table_supports(const CSPTable *table, size_t index,
+	size_t value
+){
+	if (value >= table->offsets[index + 1] - table->offsets[index]) {
+		return NULL;
+	}
+	return &table->supports[(table->offsets[index] + value) * table->num_words];
+}
+
+// Check that the tuple of the values is allowed
+static bool table_check(const CSPConstraint *constraint, const size_t *values,
+	const void *UNUSED_VAR(data)
+){
+	const CSPTable *table = constraint->table;
+	bool found = false;
+
+	for (size_t w = 0; w < table->num_words && !found; w++) {
+		uint64_t word = UINT64_MAX;
+		for (size_t i = 0; i < constraint->arity && word != 0; i++) {
+			const uint64_t *set = table_supports(table, i,
+				values[constraint->variables[i]]
+			);
+			word = set != NULL ? word & set[w] : 0;
+		}
+		found = word != 0;
+	}
+	return found == table->allowed;
+}
+
+// Keep the values of a variable whose tuple with the values of the other
+// variables is allowed
+static void table_domain_check(const CSPConstraint *constraint,
+	const size_t *values, const void *UNUSED_VAR(data), size_t variable,
+	size_t base, const uint64_t *words, size_t num_words, uint64_t *keep
+){
+	const CSPTable *table = constraint->table;
+	size_t index = 0;
+	while (constraint->variables[index] != variable) {
+		index++;
+	}
+
+	// Find the values of the set in a tuple matching the other variables, by
+	// slices of the tuples
+	uint64_t match[TABLE_MATCH_WORDS];
+	for (size_t w = 0; w < num_words; w++) {
+		keep[w] = 0;
+	}
+	for (size_t start = 0; start < table->num_words;
+		start += TABLE_MATCH_WORDS
+	) {
+		size_t count = table->num_words - start < TABLE_MATCH_WORDS
+			? table->num_words - start : TABLE_MATCH_WORDS;
+		for (size_t k = 0; k < count; k++) {
+			match[k] = UINT64_MAX;
+		}
+
+		bool matched = true;
+		for (size_t i = 0; i < constraint->arity && matched; i++) {
+			if (i == index) {
+				continue;
+			}
+			const uint64_t *set = table_supports(table, i,
+				values[constraint->variables[i]]
+			);
+			matched = set != NULL;
+			for (size_t k = 0; k < count && matched; k++) {
+				match[k] &= set[start + k];
+			}
+		}
+		if (!matched) {
+			// A value of the other variables is in no tuple
+			break;
+		}
+
+		for (size_t w = 0; w < num_words; w++) {
+			for (uint64_t left = words[w] & ~keep[w]; left; left &= left - 1) {
+				const uint64_t *set = table_supports(table, index,
+					base + w * 64 + bits_ctz(left)
+				);
+				if (set == NULL) {
+					continue;
+				}
+
+				for (size_t k = 0; k < count; k++) {
+					if (match[k] & set[start + k]) {
+						keep[w] |= left & -left;
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	if (!table->allowed) {
+		for (size_t w = 0; w < num_words; w++) {
+			keep[w] = words[w] & ~keep[w];
+		}
+	}
+}
+
+// PUBLIC
+// Constructors
+CSPConstraint *csp_constraint_create_table(size_t arity,
+	const size_t *tuples, size_t num_tuples, bool allowed
+){
+	assert(csp_initialised());
+	assert(arity > 0);
+
+	CSPConstraint *constraint = csp_constraint_create(arity, table_check);
+	if (constraint == NULL) {
+		return NULL;
+	}
+
+	CSPTable *table = malloc(sizeof(CSPTable) + (arity + 1) * sizeof(size_t));
+	if (table == NULL) {
+		perror("malloc");
+		csp_constraint_destroy(constraint);
+		return NULL;
+	}
+	table->allowed = allowed;
+	table->num_words = (num_tuples + 63) / 64;
+
+	// Each variable has a set per value up to its largest one in the tuples
+	table->offsets[0] = 0;
+	for (size_t i = 0; i < arity; i++) {
+		size_t size = 0;
+		for (size_t t = 0; t < num_tuples; t++) {
+			if (tuples[t * arity + i] >= size) {
+				size = tuples[t * arity + i] + 1;
+			}
+		}
+		table->offsets[i + 1] = table->offsets[i] + size;
+	}
+
+	size_t num_sets = table->offsets[arity];
+	table->supports = calloc(num_sets * table->num_words > 0
+		? num_sets * table->num_words : 1, sizeof(uint64_t)
+	);
+	if (table->supports == NULL) {
+		perror("calloc");
+		free(table);
+		csp_constraint_destroy(constraint);
+		return NULL;
+	}
+	for (size_t t = 0; t < num_tuples; t++) {
+		for (size_t i = 0; i < arity; i++) {
+			size_t set = table->offsets[i] + tuples[t * arity + i];
+			table->supports[set * table->num_words + t / 64]
+				|= (uint64_t) 1 << t % 64;
+		}
+	}
+
+	constraint->table = table;
+	constraint->domain_check = table_domain_check;
+
+	return constraint;
+}
+
+// Getters
+bool csp_constraint_is_table(const CSPConstraint *constraint){
+	assert(csp_initialised());
+
+	return constraint->table != NULL;
+}
+bool csp_constraint_get_table_allowed(const CSPConstraint *constraint){
+	assert(csp_initialised());
+	assert(constraint->table != NULL);
+
+	return constraint->table->allowed;
+}
+size_t csp_constraint_get_table_words(const CSPConstraint *constraint){
+	assert(csp_initialised());
+	assert(constraint->table != NULL);
+
+	return constraint->table->num_words;
+}
+const uint64_t *csp_constraint_get_table_supports(
+	const CSPConstraint *constraint, size_t index, size_t value
+){
+	assert(csp_initialised());
+	assert(constraint->table != NULL);
+	assert(index < constraint->arity);
+
+	return table_supports(constraint->table, index, value);
+}
@@ -0,0 +1,85 @@
+/**
+ * @file csp-constraint-table.h
+ * Defines the table constraints, given by the list of their allowed or
+ * forbidden tuples.
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#pragma once
+
+#if !defined (_CSP_H_INSIDE) && !defined (CSP_COMPILATION)
+#error "Only <csp/csp.h> can be included directly."
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "core/csp-constraint.h"
+
+// CONSTRUCTORS
+/**
+ * @brief Create a table constraint from the list of its allowed or forbidden
+ * tuples. The tuples are stored as the set of the tuples in which each variable
+ * takes each value, one bit per tuple, so that the check function and the
+ * domain check function of the constraint only use word operations.
+ * @param arity The arity of the constraint.
+ * @param tuples The tuples, arity values each, the value at the index i of a
+ * tuple being the value of the variable at the index i of the constraint.
+ * @param num_tuples The number of tuples.
+ * @param allowed true if the tuples are the only allowed ones, false if they
+ * are the only forbidden ones.
+ * @return The constraint created or NULL if an error occurred.
+ * @pre The csp library is initialised.
+ * @pre arity > 0
+ * @post The constraint variables are initialised to 0.
+ * @post The constraint has a check function and a domain check function.
+ * @note The variables of the constraint are expected to be distinct.
+ */
+extern CSPConstraint *csp_constraint_create_table(size_t arity,
+	const size_t *tuples, size_t num_tuples, bool allowed
+);
+
+// GETTERS
+/**
+ * @brief Get whether the constraint is a table constraint.
+ * @param constraint The constraint.
+ * @return true if the constraint was created from a table, false otherwise.
+ * @pre The csp library is initialised.
+ */
+extern bool csp_constraint_is_table(const CSPConstraint *constraint);
+/**
+ * @brief Get whether the tuples of a table constraint are the allowed ones.
+ * @param constraint The table constraint.
+ * @return true if the tuples are the allowed ones, false if they are the
+ * forbidden ones.
+ * @pre The csp library is initialised.
+ * @pre The constraint is a table constraint.
+ */
+extern bool csp_constraint_get_table_allowed(const CSPConstraint *constraint);
+/**
+ * @brief Get the number of words of a set of tuples of a table constraint.
+ * @param constraint The table constraint.
+ * @return The number of words, 64 tuples each.
+ * @pre The csp library is initialised.
+ * @pre The constraint is a table constraint.
+ */
+extern size_t csp_constraint_get_table_words(const CSPConstraint *constraint);
+/**
+ * @brief Get the set of the tuples of a table constraint in which a variable
+ * takes a value.
+ * @param constraint The table constraint.
+ * @param index The index of the variable in the constraint.
+ * @param value The value.
+ * @return The set of tuples, the bit t of the word w standing for the tuple
+ * 64 * w + t, or NULL if no tuple has this value for the variable.
+ * @pre The csp library is initialised.
+ * @pre The constraint is a table constraint.
+ * @pre index < constraint->arity
+ */
+extern const uint64_t *csp_constraint_get_table_supports(
+	const CSPConstraint *constraint, size_t index, size_t value
+);
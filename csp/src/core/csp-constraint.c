@@ -35,6 +35,9 @@ CSPConstraint *csp_constraint_create(size_t arity, CSPChecker *check){
 	if(constraint != NULL){
 		constraint->arity = arity;
 		constraint->check = check;
+		constraint->domain_check = NULL;
+		constraint->constant = 0;
+		constraint->table = NULL;
 		memset(constraint->variables, 0, arity * sizeof(size_t));
 	}
 
@@ -46,6 +49,10 @@ void csp_constraint_destroy(CSPConstraint *constraint){
 	assert(csp_initialised());
 	assert(printf("Destroying constraint with arity %lu\n", constraint->arity));
 
+	if(constraint->table != NULL){
+		free(constraint->table->supports);
+		free(constraint->table);
+	}
 	free(constraint);
 }
 
@@ -60,6 +67,13 @@ CSPChecker *csp_constraint_get_check(const CSPConstraint *constraint){
 
 	return constraint->check;
 }
+CSPDomainChecker *csp_constraint_get_domain_check(
+	const CSPConstraint *constraint
+){
+	assert(csp_initialised());
+
+	return constraint->domain_check;
+}
 size_t csp_constraint_get_variable(const CSPConstraint *constraint,
 	size_t index
 ){
@@ -77,4 +91,11 @@ void csp_constraint_set_variable(CSPConstraint *constraint,
 	assert(index < constraint->arity);
 
 	constraint->variables[index] = variable;
+}
+void csp_constraint_set_domain_check(CSPConstraint *constraint,
+	CSPDomainChecker *domain_check
+){
+	assert(csp_initialised());
+
+	constraint->domain_check = domain_check;
 }
\ No newline at end of file
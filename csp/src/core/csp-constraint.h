@@ -14,6 +14,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 // TYPE DEFINITIONS
 /**
@@ -32,6 +33,28 @@ typedef struct _CSPConstraint CSPConstraint;
  */
 typedef bool CSPChecker(const CSPConstraint *, const size_t *, const void *);
 
+/**
+ * @brief The domain check function of a CSP constraint, checking every value
+ * of a set for one of its variables at once, the others keeping their values.
+ * @param constraint The constraint to check.
+ * @param values The values of the variables.
+ * @param data The data to pass to the check function.
+ * @param variable The variable whose values are checked.
+ * @param base The value of the first bit of the set, a multiple of 64.
+ * @param words The set of values to check, the bit b of the word w standing
+ * for the value base + 64 * w + b.
+ * @param num_words The number of words of the set.
+ * @param keep The words receiving the bits of the values of the set
+ * satisfying the constraint.
+ * @pre constraint != NULL
+ * @pre values != NULL
+ * @pre variable is a variable of the constraint.
+ * @post The bits of keep are a subset of the bits of words.
+ */
+typedef void CSPDomainChecker(const CSPConstraint *, const size_t *,
+	const void *, size_t, size_t, const uint64_t *, size_t, uint64_t *
+);
+
 // CONSTRUCTORS
 /**
  * @brief Create a constraint with the specified arity and check function.
@@ -44,6 +67,7 @@ typedef bool CSPChecker(const CSPConstraint *, const size_t *, const void *);
  * @post The constraint variables are initialised to 0.
  * @post The constraint arity is set to the specified arity.
  * @post The constraint check function is set to the specified check function.
+ * @post The constraint has no domain check function.
  */
 extern CSPConstraint *csp_constraint_create(size_t arity, CSPChecker *check);
 
@@ -73,6 +97,15 @@ extern size_t csp_constraint_get_arity(const CSPConstraint *constraint);
  * @pre The csp library is initialised.
  */
 extern CSPChecker *csp_constraint_get_check(const CSPConstraint *constraint);
+/**
+ * @brief Get the domain check function of the constraint.
+ * @param constraint The constraint to get the domain check function.
+ * @return The domain check function of the constraint, NULL if it has none.
+ * @pre The csp library is initialised.
+ */
+extern CSPDomainChecker *csp_constraint_get_domain_check(
+	const CSPConstraint *constraint
+);
 /**
  * @brief Get the variable of the constraint at the specified index.
  * @param constraint The constraint to get the variable.
@@ -96,4 +129,15 @@ extern size_t csp_constraint_get_variable(const CSPConstraint *constraint,
  */
 extern void csp_constraint_set_variable(CSPConstraint *constraint,
 	size_t index, size_t variable
+);
+/**
+ * @brief Set the domain check function of the constraint, which the solver
+ * prefers to the check function to filter the domain of a variable.
+ * @param constraint The constraint to set the domain check function.
+ * @param domain_check The domain check function, agreeing with the check
+ * function on every value, or NULL to only use the check function.
+ * @pre The csp library is initialised.
+ */
+extern void csp_constraint_set_domain_check(CSPConstraint *constraint,
+	CSPDomainChecker *domain_check
 );
\ No newline at end of file
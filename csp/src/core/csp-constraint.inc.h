@@ -7,18 +7,44 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include "csp-constraint.h"
 
+/**
+ * @brief The tuples of a table constraint, kept as the set of the tuples in
+ * which each variable takes each value.
+ * @var allowed Whether the tuples are the allowed ones or the forbidden ones.
+ * @var num_words The number of words of a set of tuples.
+ * @var supports The sets of tuples, num_words words each, the sets of the
+ * values of each variable following each other.
+ * @var offsets The index in supports of the set of the value 0 of each
+ * variable, the last of the arity + 1 entries being the number of sets.
+ */
+typedef struct {
+  bool allowed;
+  size_t num_words;
+  uint64_t *supports;
+  size_t offsets[];
+} CSPTable;
+
 /**
  * @brief The constraint of a CSP problem.
  * @var check The check function of the constraint.
+ * @var domain_check The domain check function of the constraint, NULL if it
+ * has none.
+ * @var constant The constant of a built-in constraint, 0 for the others.
+ * @var table The tuples of a table constraint, NULL for the others.
  * @var arity The arity of the constraint.
  * @var variables The variables of the constraint.
  */
 struct _CSPConstraint {
   CSPChecker *check;
+  CSPDomainChecker *domain_check;
+  ptrdiff_t constant;
+  CSPTable *table;
   size_t arity;
   size_t variables[];
 };
\ No newline at end of file
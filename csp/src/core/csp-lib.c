@@ -8,13 +8,16 @@
 
 #include "csp-lib.h"
 
+#include <stdatomic.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <assert.h>
 
 // PRIVATE
-static int counter = 0;
+// The number of initialisations not finished yet, shared by every thread
+static atomic_size_t counter = 0;
 
 // Assertions
 static void verify(void){
@@ -24,14 +27,13 @@ static void verify(void){
 // PUBLIC
 // Initializers / Finishers
 bool csp_init(void){
-	static bool first = true;
+	static atomic_flag registered = ATOMIC_FLAG_INIT;
 
-	if(first){
+	if(!atomic_flag_test_and_set(&registered)){
 		assert(atexit(verify) == 0);
-		first = false;
 	}
 
-	if(!counter++){
+	if(!atomic_fetch_add(&counter, 1)){
 		assert(printf("CSP initialised\n"));
 	}
 
@@ -39,18 +41,23 @@ bool csp_init(void){
 }
 
 bool csp_finish(void){
-	if(counter){
-		if(!--counter){
-			assert(printf("CSP finished\n"));
+	size_t current = atomic_load(&counter);
+
+	// Only decrement the counter of an initialised library
+	do{
+		if(!current){
+			return false;
 		}
+	}while(!atomic_compare_exchange_weak(&counter, &current, current - 1));
 
-		return true;
-	}else{
-		return false;
+	if(current == 1){
+		assert(printf("CSP finished\n"));
 	}
+
+	return true;
 }
 
 // Getters
 bool csp_initialised(void){
-  	return counter > 0;
+  	return atomic_load(&counter) > 0;
 }
\ No newline at end of file
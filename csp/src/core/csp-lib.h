@@ -19,6 +19,8 @@
  * @brief Initialise the CSP library.
  * @return true if the library is initialised, false otherwise.
  * @post The library is initialised.
+ * @note The library counts its initialisations atomically, so that threads can
+ * initialise and finish it concurrently.
  */
 extern bool csp_init(void);
 
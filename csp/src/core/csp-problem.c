@@ -8,6 +8,7 @@
 
 #include "csp-problem.h"
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdlib.h>
 #include <stdio.h>
@@ -18,6 +19,16 @@
 
 #include "csp-problem.inc.h"
 
+// PRIVATE
+static void discard_index(CSPProblem *csp){
+	free(csp->variable_offsets);
+	free(csp->variable_constraints);
+	free(csp->variable_constraint_ids);
+	csp->variable_offsets = NULL;
+	csp->variable_constraints = NULL;
+	csp->variable_constraint_ids = NULL;
+}
+
 // PUBLIC
 // Constructors
 CSPProblem *csp_problem_create(size_t num_domains, size_t num_constraints) {
@@ -49,6 +60,9 @@ CSPProblem *csp_problem_create(size_t num_domains, size_t num_constraints) {
 
 				csp->num_domains = num_domains;
 				csp->num_constraints = num_constraints;
+				csp->variable_offsets = NULL;
+				csp->variable_constraints = NULL;
+				csp->variable_constraint_ids = NULL;
 			}else{
 				free(csp->domains);
 				free(csp);
@@ -66,6 +80,83 @@ CSPProblem *csp_problem_create(size_t num_domains, size_t num_constraints) {
 	return csp;
 }
 
+bool csp_problem_finalise(CSPProblem *csp){
+	assert(csp_initialised());
+
+	discard_index(csp);
+
+	size_t *offsets = calloc(csp->num_domains + 1, sizeof(size_t));
+	size_t *cursors = malloc(csp->num_domains * sizeof(size_t));
+	if(offsets == NULL || cursors == NULL){
+		free(offsets);
+		free(cursors);
+		return false;
+	}
+
+	// Count the constraints of each variable
+	for(size_t i = 0; i < csp->num_constraints; i++){
+		const CSPConstraint *constraint = csp->constraints[i];
+		assert(constraint != NULL);
+
+		for(size_t k = 0; k < csp_constraint_get_arity(constraint); k++){
+			assert(csp_constraint_get_variable(constraint, k) < csp->num_domains);
+			offsets[csp_constraint_get_variable(constraint, k) + 1]++;
+		}
+	}
+	for(size_t i = 0; i < csp->num_domains; i++){
+		offsets[i + 1] += offsets[i];
+		cursors[i] = offsets[i];
+	}
+
+	size_t num_entries = offsets[csp->num_domains] > 0
+		? offsets[csp->num_domains] : 1;
+	CSPConstraint **entries = malloc(num_entries * sizeof(CSPConstraint *));
+	size_t *ids = malloc(num_entries * sizeof(size_t));
+	if(entries == NULL || ids == NULL){
+		free(offsets);
+		free(cursors);
+		free(entries);
+		free(ids);
+		return false;
+	}
+
+	// Fill the constraints of each variable, a constraint mentioning a variable
+	// twice is only indexed once
+	for(size_t i = 0; i < csp->num_constraints; i++){
+		CSPConstraint *constraint = csp->constraints[i];
+
+		for(size_t k = 0; k < csp_constraint_get_arity(constraint); k++){
+			size_t variable = csp_constraint_get_variable(constraint, k);
+
+			if(cursors[variable] == offsets[variable]
+				|| entries[cursors[variable] - 1] != constraint
+			){
+				ids[cursors[variable]] = i;
+				entries[cursors[variable]++] = constraint;
+			}
+		}
+	}
+
+	// Compact the entries left empty by duplicated variables
+	size_t total = 0;
+	for(size_t i = 0; i < csp->num_domains; i++){
+		size_t start = offsets[i];
+		offsets[i] = total;
+		for(size_t j = start; j < cursors[i]; j++){
+			ids[total] = ids[j];
+			entries[total++] = entries[j];
+		}
+	}
+	offsets[csp->num_domains] = total;
+	free(cursors);
+
+	csp->variable_offsets = offsets;
+	csp->variable_constraints = entries;
+	csp->variable_constraint_ids = ids;
+
+	return true;
+}
+
 // Destructors
 void csp_problem_destroy(CSPProblem *csp) {
 	assert(csp_initialised());
@@ -74,6 +165,7 @@ void csp_problem_destroy(CSPProblem *csp) {
 		csp->num_domains, csp->num_constraints
 	));
 
+	discard_index(csp);
 	free(csp->constraints);
 	free(csp->domains);
 	free(csp);
@@ -102,6 +194,31 @@ size_t csp_problem_get_domain(const CSPProblem *csp, size_t index){
 
 	return csp->domains[index];
 }
+bool csp_problem_is_finalised(const CSPProblem *csp){
+	assert(csp_initialised());
+
+	return csp->variable_offsets != NULL;
+}
+CSPConstraint *const *csp_problem_get_variable_constraints(
+	const CSPProblem *csp, size_t index, size_t *amount
+){
+	assert(csp_initialised());
+	assert(csp->variable_offsets != NULL);
+	assert(index < csp->num_domains);
+
+	*amount = csp->variable_offsets[index + 1] - csp->variable_offsets[index];
+	return csp->variable_constraints + csp->variable_offsets[index];
+}
+const size_t *csp_problem_get_variable_constraint_ids(const CSPProblem *csp,
+	size_t index, size_t *amount
+){
+	assert(csp_initialised());
+	assert(csp->variable_offsets != NULL);
+	assert(index < csp->num_domains);
+
+	*amount = csp->variable_offsets[index + 1] - csp->variable_offsets[index];
+	return csp->variable_constraint_ids + csp->variable_offsets[index];
+}
 
 // Setters
 void csp_problem_set_constraint(CSPProblem *csp,
@@ -111,6 +228,7 @@ void csp_problem_set_constraint(CSPProblem *csp,
 	assert(index < csp->num_constraints);
 	assert(constraint != NULL);
 
+	discard_index(csp);
 	csp->constraints[index] = constraint;
 }
 void csp_problem_set_domain(CSPProblem *csp, size_t index, size_t domain){
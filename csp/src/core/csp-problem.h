@@ -44,6 +44,20 @@ extern CSPProblem *csp_problem_create(
 	size_t num_domains, size_t num_constraints
 );
 
+/**
+ * @brief Finalise the CSP problem by indexing the constraints of each variable.
+ * @param csp The CSP problem to finalise.
+ * @return true if the CSP problem is finalised, false if an error occurred.
+ * @pre The csp library is initialised.
+ * @pre Every constraint of the CSP problem is set.
+ * @pre Every constraint variable is lower than the number of domains.
+ * @post The constraints of each variable can be retrieved with
+ * #csp_problem_get_variable_constraints.
+ * @note The constraints variables must not be changed afterwards, setting a
+ * constraint of the CSP problem discards the index.
+ */
+extern bool csp_problem_finalise(CSPProblem *csp);
+
 // DESTRUCTORS
 /**
  * @brief Destroy the CSP problem.
@@ -89,6 +103,43 @@ extern size_t csp_problem_get_num_domains(const CSPProblem *csp);
  * @pre index < csp->num_domains
  */
 extern size_t csp_problem_get_domain(const CSPProblem *csp, size_t index);
+/**
+ * @brief Verify if the CSP problem is finalised.
+ * @param csp The CSP problem to verify.
+ * @return true if the constraints of each variable are indexed, false
+ * otherwise.
+ * @pre The csp library is initialised.
+ */
+extern bool csp_problem_is_finalised(const CSPProblem *csp);
+/**
+ * @brief Get the constraints involving the variable at the specified index.
+ * @param csp The CSP problem to get the constraints.
+ * @param index The index of the variable.
+ * @param amount Pointer to size_t to store the number of constraints.
+ * @return The constraints involving the variable, in the order of the CSP
+ * problem constraints.
+ * @pre The csp library is initialised.
+ * @pre The CSP problem is finalised.
+ * @pre index < csp->num_domains
+ */
+extern CSPConstraint *const *csp_problem_get_variable_constraints(
+	const CSPProblem *csp, size_t index, size_t *amount
+);
+/**
+ * @brief Get the indexes of the constraints involving the variable at the
+ * specified index.
+ * @param csp The CSP problem to get the constraint indexes.
+ * @param index The index of the variable.
+ * @param amount Pointer to size_t to store the number of constraints.
+ * @return The index of each constraint returned by
+ * #csp_problem_get_variable_constraints, in the same order.
+ * @pre The csp library is initialised.
+ * @pre The CSP problem is finalised.
+ * @pre index < csp->num_domains
+ */
+extern const size_t *csp_problem_get_variable_constraint_ids(
+	const CSPProblem *csp, size_t index, size_t *amount
+);
 
 // SETTERS
 /**
@@ -17,10 +17,19 @@
  * @var domains The domains of the variables.
  * @var num_constraints The number of constraints.
  * @var constraints The constraints of the problem.
+ * @var variable_offsets The offsets of each variable constraints in
+ * variable_constraints (num_domains + 1 entries), NULL if not finalised.
+ * @var variable_constraints The constraints of each variable, stored
+ * contiguously variable after variable, NULL if not finalised.
+ * @var variable_constraint_ids The index in constraints of each entry of
+ * variable_constraints, NULL if not finalised.
  */
 struct _CSPProblem {
 	size_t num_domains;
 	size_t *domains;
 	size_t num_constraints;
 	CSPConstraint **constraints;
+	size_t *variable_offsets;
+	CSPConstraint **variable_constraints;
+	size_t *variable_constraint_ids;
   };
\ No newline at end of file
@@ -30,12 +30,22 @@ COPYING.LESSER). If not, see https://www.gnu.org/licenses/.
 
 #include "core/csp-lib.h"
 #include "core/csp-constraint.h"
+#include "core/csp-constraint-builtins.h"
+#include "core/csp-constraint-table.h"
 #include "core/csp-problem.h"
 
 #include "solver/csp-solver.h"
 #include "solver/csp-solver-fc.h"
+#include "solver/csp-solver-batch.h"
+#include "solver/csp-solver-enumerate.h"
+#include "solver/csp-solver-incremental.h"
+#include "solver/csp-solver-mac.h"
+#include "solver/csp-solver-minimize.h"
 #include "solver/csp-solver-ovars.h"
-// #include "solver/csp-solver-ovals.h"
+#include "solver/csp-solver-ovals.h"
+#include "solver/csp-solver-parallel.h"
+#include "solver/csp-solver-portfolio.h"
+#include "solver/csp-solver-trace.h"
 
 #include "solver/types-and-structs.h"
 
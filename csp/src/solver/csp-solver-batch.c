@@ -0,0 +1,206 @@
+/**
+ * @file csp-solver-batch.c
+ * Library CSP batch solving of many independent instances on threads
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#include "solver/csp-solver-batch.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "core/csp-lib.h"
+#include "core/csp-problem.h"
+#include "solver/csp-solver.h"
+#include "solver/types-and-structs.h"
+
+#include "solver/csp-solver.inc.h"
+
+// The number of chunks of instances each thread takes on average
+#define CHUNKS_PER_THREAD 8
+// The largest number of instances a thread takes at once
+#define MAX_CHUNK 64
+
+/**
+ * @brief The instances shared by the threads of a batch.
+ * @var instances The instances to solve.
+ * @var num_instances The number of instances.
+ * @var solve_type The type of solving to use.
+ * @var limits The limits of the solve of each instance, NULL for no limit.
+ * @var outcomes The outcome of each instance.
+ * @var chunk The number of instances a thread takes at once.
+ * @var next The index of the first instance no thread took yet.
+ * @var error Whether an instance could not be solved because of an error.
+ */
+typedef struct {
+	const CSPBatchInstance *instances;
+	size_t num_instances;
+	SolveType solve_type;
+	const CSPSolveLimits *limits;
+	SolveOutcome *outcomes;
+	size_t chunk;
+	atomic_size_t next;
+	atomic_bool error;
+} CSPBatch;
+
+/**
+ * @brief A thread of a batch.
+ * @var batch The instances shared by the threads.
+ * @var solver The solver of the thread, bound to the CSP problem of the last
+ * instance it solved, NULL before the first one.
+ * @var stats The statistics of the solves of the thread.
+ */
+typedef struct {
+	CSPBatch *batch;
+	CSPSolver *solver;
+	CSPSolveStats stats;
+} CSPBatchWorker;
+
+// PRIVATE
+// Bind the solver of the thread to a CSP problem, only creating it if the
+// CSP problem does not fit in its buffers
+static bool csp_batch_bind(CSPBatchWorker *worker, const CSPProblem *csp){
+	assert(csp_problem_is_finalised(csp));
+
+	if (worker->solver != NULL && (worker->solver->csp == csp
+		|| csp_solver_reset(worker->solver, csp)
+	)) {
+		return true;
+	}
+
+	if (worker->solver != NULL) {
+		csp_solver_destroy(worker->solver);
+	}
+	worker->solver = csp_solver_create(csp);
+	if (worker->solver == NULL) {
+		return false;
+	}
+	csp_solver_set_limits(worker->solver, worker->batch->limits);
+
+	return true;
+}
+
+static void *csp_batch_run(void *arg){
+	CSPBatchWorker *worker = arg;
+	CSPBatch *batch = worker->batch;
+
+	while (true) {
+		size_t start = atomic_fetch_add_explicit(&batch->next, batch->chunk,
+			memory_order_relaxed
+		);
+		if (start >= batch->num_instances) {
+			break;
+		}
+		size_t end = batch->num_instances - start > batch->chunk
+			? start + batch->chunk : batch->num_instances;
+
+		for (size_t i = start; i < end; i++) {
+			const CSPBatchInstance *instance = &batch->instances[i];
+
+			if (!csp_batch_bind(worker, instance->csp)) {
+				batch->outcomes[i] = OUTCOME_UNKNOWN;
+				atomic_store(&batch->error, true);
+				continue;
+			}
+
+			csp_solver_solve(worker->solver, instance->values, instance->data,
+				batch->solve_type, NULL, NULL, NULL
+			);
+			batch->outcomes[i] = csp_solver_get_outcome(worker->solver);
+			csp_solver_merge_stats(&worker->stats, &worker->solver->stats,
+				false
+			);
+		}
+	}
+
+	return NULL;
+}
+
+// PUBLIC
+// Functions
+bool csp_problem_solve_batch(const CSPBatchInstance *instances,
+	size_t num_instances, SolveType solve_type, const CSPSolveLimits *limits,
+	size_t num_threads, SolveOutcome *outcomes, CSPSolveStats *stats
+){
+	assert(csp_initialised());
+	assert(num_threads > 0);
+
+	if (stats != NULL) {
+		*stats = (CSPSolveStats) {0};
+	}
+	if (num_instances == 0) {
+		return true;
+	}
+	if (num_threads > num_instances) {
+		num_threads = num_instances;
+	}
+
+	// Small chunks balance the threads, large ones spare the shared counter
+	CSPBatch batch = {
+		.instances = instances,
+		.num_instances = num_instances,
+		.solve_type = solve_type,
+		.limits = limits,
+		.outcomes = outcomes,
+		.chunk = num_instances / (num_threads * CHUNKS_PER_THREAD)
+	};
+	if (batch.chunk == 0) {
+		batch.chunk = 1;
+	} else if (batch.chunk > MAX_CHUNK) {
+		batch.chunk = MAX_CHUNK;
+	}
+	atomic_init(&batch.next, 0);
+	atomic_init(&batch.error, false);
+
+	CSPBatchWorker *workers = calloc(num_threads, sizeof(CSPBatchWorker));
+	pthread_t *threads = malloc(num_threads * sizeof(pthread_t));
+	if (workers == NULL || threads == NULL) {
+		perror(workers == NULL ? "calloc" : "malloc");
+		free(workers);
+		free(threads);
+		return false;
+	}
+	for (size_t i = 0; i < num_threads; i++) {
+		workers[i].batch = &batch;
+	}
+
+	// The calling thread solves as well, the instances left to the threads
+	// which failed to start being taken by the others
+	size_t started = 0;
+	for (; started < num_threads - 1; started++) {
+		int code = pthread_create(&threads[started], NULL, csp_batch_run,
+			&workers[started]
+		);
+		if (code != 0) {
+			errno = code;
+			perror("pthread_create");
+			break;
+		}
+	}
+	csp_batch_run(&workers[num_threads - 1]);
+	for (size_t i = 0; i < started; i++) {
+		pthread_join(threads[i], NULL);
+	}
+	free(threads);
+
+	for (size_t i = 0; i < num_threads; i++) {
+		if (stats != NULL) {
+			csp_solver_merge_stats(stats, &workers[i].stats, false);
+		}
+		if (workers[i].solver != NULL) {
+			csp_solver_destroy(workers[i].solver);
+		}
+	}
+	free(workers);
+
+	return !atomic_load(&batch.error);
+}
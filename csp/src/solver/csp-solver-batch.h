@@ -0,0 +1,63 @@
+/**
+ * @file csp-solver-batch.h
+ * Library CSP batch solving of many independent instances on threads
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#pragma once
+
+#if !defined (_CSP_H_INSIDE) && !defined (CSP_COMPILATION)
+#error "Only <csp/csp.h> can be included directly."
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "core/csp-problem.h"
+#include "solver/csp-solver.h"
+#include "solver/types-and-structs.h"
+
+/**
+ * @brief An instance of a batch, a CSP problem and the data to solve it with.
+ * @var csp The CSP problem to solve, which may be shared with other instances.
+ * @var data The data to pass to the check function.
+ * @var values The values of the variables, receiving the solution.
+ */
+typedef struct {
+	const CSPProblem *csp;
+	const void *data;
+	size_t *values;
+} CSPBatchInstance;
+
+/**
+ * Solve independent instances on a pool of threads. Each thread takes the
+ * next instances left and keeps its solver from an instance to the next one.
+ * The solver is bound to the CSP problem of the next instance by
+ * #csp_solver_reset, which keeps its buffers and only allocates the arcs and
+ * residues of a larger CSP problem and the current tables of table
+ * constraints. Another solver is created when the CSP problem does not fit.
+ * @param instances The instances to solve.
+ * @param num_instances The number of instances.
+ * @param solve_type The type of solving to use.
+ * @param limits The limits of the solve of each instance, NULL for no limit.
+ * @param num_threads The number of threads.
+ * @param outcomes The outcome of each instance, OUTCOME_UNKNOWN if its limits
+ * were reached or an error occurred.
+ * @param stats The statistics of the solves added together, their times being
+ * summed, NULL if not required.
+ * @return false if an error occurred, true otherwise.
+ * @pre The csp library is initialised.
+ * @pre The CSP problems of the instances are finalised.
+ * @pre num_threads > 0.
+ * @post The values of each solved instance are assigned to its solution.
+ * @note The instances sharing a CSP problem are best kept next to each other,
+ * a thread then reusing its solver as is. Their check functions are called
+ * concurrently and must not modify the CSP problem.
+ */
+extern bool csp_problem_solve_batch(const CSPBatchInstance *instances,
+	size_t num_instances, SolveType solve_type, const CSPSolveLimits *limits,
+	size_t num_threads, SolveOutcome *outcomes, CSPSolveStats *stats
+);
@@ -0,0 +1,132 @@
+/**
+ * @file csp-solver-buckets.c
+ * Library CSP unfilled variables bucketed by domain size
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "solver/types-and-structs.h"
+#include "util/random.h"
+
+#include "solver/csp-solver.inc.h"
+
+// PRIVATE
+// Swap a variable with the one at a position of the order
+static void bucket_swap(CSPSolver *solver, size_t variable, size_t position){
+	size_t other = solver->bucket_order[position];
+	size_t from = solver->bucket_positions[variable];
+
+	solver->bucket_order[from] = other;
+	solver->bucket_positions[other] = from;
+	solver->bucket_order[position] = variable;
+	solver->bucket_positions[variable] = position;
+}
+
+// Move a variable to the bucket of a key, one bucket boundary at a time
+static void bucket_move(CSPSolver *solver, size_t variable, size_t key){
+	size_t *starts = solver->bucket_starts;
+	size_t *keys = solver->bucket_keys;
+
+	while (keys[variable] < key) {
+		// Become the first variable of the next bucket
+		size_t next = keys[variable] + 1;
+		bucket_swap(solver, variable, --starts[next]);
+		keys[variable] = next;
+	}
+	while (keys[variable] > key) {
+		// Become the last variable of the previous bucket
+		bucket_swap(solver, variable, starts[keys[variable]]++);
+		keys[variable]--;
+	}
+}
+
+// Get the key of a variable, 0 if filled and its domain size plus one if not
+static size_t bucket_key(const CSPSolver *solver, size_t variable){
+	return filled_variables_is_filled(solver->fv, variable)
+		? 0 : solver->domains[variable]->amount + 1;
+}
+
+// PUBLIC
+// Functions
+void csp_solver_build_buckets(CSPSolver *solver){
+	size_t *starts = solver->bucket_starts;
+
+	// Sort the variables by key, counting the variables of each bucket first
+	for (size_t k = 0; k <= solver->num_buckets; k++) {
+		starts[k] = 0;
+	}
+	for (size_t i = 0; i < solver->num_domains; i++) {
+		solver->bucket_keys[i] = bucket_key(solver, i);
+		starts[solver->bucket_keys[i] + 1]++;
+	}
+	for (size_t k = 1; k <= solver->num_buckets; k++) {
+		starts[k] += starts[k - 1];
+	}
+	for (size_t i = 0; i < solver->num_domains; i++) {
+		size_t position = starts[solver->bucket_keys[i]]++;
+		solver->bucket_order[position] = i;
+		solver->bucket_positions[i] = position;
+	}
+
+	// Placing the variables moved each start to the next bucket
+	for (size_t k = solver->num_buckets; k > 0; k--) {
+		starts[k] = starts[k - 1];
+	}
+	starts[0] = 0;
+
+	solver->bucket_synced = solver->stack_top;
+}
+
+void csp_solver_sync_buckets(CSPSolver *solver){
+	for (size_t i = solver->bucket_synced; i < solver->stack_top; i++) {
+		size_t variable = solver->change_stack[i].domain_index;
+		if (solver->bucket_keys[variable] != 0) {
+			bucket_move(solver, variable, bucket_key(solver, variable));
+		}
+	}
+	solver->bucket_synced = solver->stack_top;
+}
+
+void csp_solver_restore_buckets(CSPSolver *solver){
+	// The changes after the last synchronisation never reached the buckets
+	for (size_t i = solver->stack_top; i < solver->bucket_synced; i++) {
+		size_t variable = solver->change_stack[i].domain_index;
+		if (solver->bucket_keys[variable] != 0) {
+			bucket_move(solver, variable, bucket_key(solver, variable));
+		}
+	}
+	if (solver->stack_top < solver->bucket_synced) {
+		solver->bucket_synced = solver->stack_top;
+	}
+}
+
+void csp_solver_fill_bucket(CSPSolver *solver, size_t variable){
+	bucket_move(solver, variable, 0);
+}
+
+void csp_solver_unfill_bucket(CSPSolver *solver, size_t variable){
+	bucket_move(solver, variable, bucket_key(solver, variable));
+}
+
+size_t csp_solver_choose_bucket(CSPSolver *solver, bool largest){
+	csp_solver_sync_buckets(solver);
+
+	// The order is sorted by domain size, after the filled variables
+	size_t variable = solver->bucket_order[
+		largest ? solver->num_domains - 1 : solver->bucket_starts[1]
+	];
+	if (solver->seed == 0) {
+		return variable;
+	}
+
+	size_t key = solver->bucket_keys[variable];
+	size_t start = solver->bucket_starts[key];
+	size_t ties = solver->bucket_starts[key + 1] - start;
+	return solver->bucket_order[start + random_below(&solver->random, ties)];
+}
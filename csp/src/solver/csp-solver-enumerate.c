@@ -0,0 +1,110 @@
+/**
+ * @file csp-solver-enumerate.c
+ * Library CSP enumeration and counting of the solutions
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#include "solver/csp-solver-enumerate.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "core/csp-lib.h"
+#include "core/csp-problem.h"
+#include "solver/csp-solver.h"
+#include "solver/types-and-structs.h"
+
+#include "solver/csp-solver.inc.h"
+
+// PUBLIC
+// Functions
+uint64_t csp_solver_enumerate(CSPSolver *solver, size_t *values,
+	const void *data, SolveType solve_type, CSPValueChecklist *checklist,
+	CSPDataChecklist *dataChecklist, CSPSolutionCallback *callback, void *arg,
+	CSPSolveStats *stats
+){
+	assert(csp_initialised());
+	assert(checklist != NULL || csp_problem_is_finalised(solver->csp));
+	assert(!(solve_type & MAC) || csp_problem_is_finalised(solver->csp));
+	assert(!(solve_type & OVALS_SUPPORTS)
+		|| csp_problem_is_finalised(solver->csp)
+	);
+	assert(!(solve_type & OVARS_DOMWDEG)
+		|| csp_problem_is_finalised(solver->csp)
+	);
+	assert(solver->restart_type == RESTARTS_NONE);
+
+	solver->enumerating = true;
+	solver->callback = callback;
+	solver->callback_arg = arg;
+
+	// The search only stops once every solution was found, or if asked to
+	if (csp_solver_prepare(solver, values, data, solve_type, dataChecklist)) {
+		csp_solver_search(solver, values, data, solve_type, checklist, NULL, 0);
+	}
+
+	solver->enumerating = false;
+	solver->callback = NULL;
+	solver->callback_arg = NULL;
+
+	if (solver->interrupted) {
+		solver->outcome = OUTCOME_UNKNOWN;
+	} else {
+		solver->outcome = solver->solutions > 0 ? OUTCOME_SAT : OUTCOME_UNSAT;
+	}
+	if (stats != NULL) {
+		*stats = solver->stats;
+	}
+
+	return solver->solutions;
+}
+
+uint64_t csp_problem_enumerate(const CSPProblem *csp, size_t *values,
+	const void *data, SolveType solve_type, CSPValueChecklist *checklist,
+	CSPDataChecklist *dataChecklist, CSPSolutionCallback *callback, void *arg,
+	CSPSolveStats *stats
+){
+	assert(csp_initialised());
+
+	CSPSolver *solver = csp_solver_create(csp);
+	if (solver == NULL) {
+		return 0;
+	}
+
+	uint64_t solutions = csp_solver_enumerate(solver, values, data, solve_type,
+		checklist, dataChecklist, callback, arg, stats
+	);
+
+	csp_solver_destroy(solver);
+
+	return solutions;
+}
+
+uint64_t csp_problem_count_solutions(const CSPProblem *csp, const void *data,
+	SolveType solve_type, CSPSolveStats *stats
+){
+	assert(csp_initialised());
+	assert(csp_problem_is_finalised(csp));
+
+	size_t num_domains = csp_problem_get_num_domains(csp);
+	size_t *values = malloc((num_domains > 0 ? num_domains : 1) * sizeof(size_t));
+	if (values == NULL) {
+		perror("malloc");
+		return 0;
+	}
+
+	uint64_t solutions = csp_problem_enumerate(csp, values, data, solve_type,
+		NULL, NULL, NULL, NULL, stats
+	);
+
+	free(values);
+
+	return solutions;
+}
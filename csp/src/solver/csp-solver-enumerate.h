@@ -0,0 +1,106 @@
+/**
+ * @file csp-solver-enumerate.h
+ * Library CSP enumeration and counting of the solutions
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#pragma once
+
+#if !defined (_CSP_H_INSIDE) && !defined (CSP_COMPILATION)
+#error "Only <csp/csp.h> can be included directly."
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "core/csp-problem.h"
+#include "solver/csp-solver.h"
+#include "solver/types-and-structs.h"
+
+/**
+ * Receive a solution of an enumeration.
+ * @param values The values of the variables, only valid during the call.
+ * @param arg The argument given with the callback.
+ * @return true to go on with the next solution, false to stop.
+ */
+typedef bool CSPSolutionCallback(const size_t *values, void *arg);
+
+/**
+ * Enumerate the solutions of the CSP problem bound to the solver, the search
+ * going on after each one.
+ * @param solver The solver to use.
+ * @param values The values of the variables.
+ * @param data The data to pass to the check function.
+ * @param solve_type The type of solving to use (FC, MAC, CBJ, OVARS, OVALS).
+ * @param checklist A pointer to function to get the list of necessary
+ * constraints for the current variable, or NULL to use the constraints index
+ * of the finalised CSP problem.
+ * @param dataChecklist A pointer to function to get the list of constraints
+ * affected by the contents of data for the current variable, or NULL to use
+ * the unary constraints of the finalised CSP problem.
+ * @param callback The callback receiving each solution, NULL to only count
+ * them.
+ * @param arg The argument to pass to the callback.
+ * @param stats The statistics of the enumeration, NULL if not required.
+ * @return The number of solutions found, every one unless the callback
+ * stopped the enumeration or csp_solver_get_outcome is OUTCOME_UNKNOWN.
+ * @pre The csp library is initialised.
+ * @pre checklist != NULL or the CSP problem is finalised.
+ * @pre The CSP problem is finalised if solve_type has MAC, OVALS_SUPPORTS or
+ * OVARS_DOMWDEG.
+ * @pre The solver does not restart.
+ * @note The limits and the cancel flag of the solver apply to the whole
+ * enumeration.
+ */
+extern uint64_t csp_solver_enumerate(CSPSolver *solver, size_t *values,
+	const void *data, SolveType solve_type, CSPValueChecklist *checklist,
+	CSPDataChecklist *dataChecklist, CSPSolutionCallback *callback, void *arg,
+	CSPSolveStats *stats
+);
+
+/**
+ * Enumerate the solutions of the CSP problem, the search going on after each
+ * one.
+ * @param csp The CSP problem to solve.
+ * @param values The values of the variables.
+ * @param data The data to pass to the check function.
+ * @param solve_type The type of solving to use (FC, MAC, CBJ, OVARS, OVALS).
+ * @param checklist A pointer to function to get the list of necessary
+ * constraints for the current variable, or NULL to use the constraints index
+ * of the finalised CSP problem.
+ * @param dataChecklist A pointer to function to get the list of constraints
+ * affected by the contents of data for the current variable, or NULL to use
+ * the unary constraints of the finalised CSP problem.
+ * @param callback The callback receiving each solution, NULL to only count
+ * them.
+ * @param arg The argument to pass to the callback.
+ * @param stats The statistics of the enumeration, NULL if not required.
+ * @return The number of solutions found, 0 if an error occurred.
+ * @pre The csp library is initialised.
+ * @pre checklist != NULL or the CSP problem is finalised.
+ * @pre The CSP problem is finalised if solve_type has MAC, OVALS_SUPPORTS or
+ * OVARS_DOMWDEG.
+ */
+extern uint64_t csp_problem_enumerate(const CSPProblem *csp, size_t *values,
+	const void *data, SolveType solve_type, CSPValueChecklist *checklist,
+	CSPDataChecklist *dataChecklist, CSPSolutionCallback *callback, void *arg,
+	CSPSolveStats *stats
+);
+
+/**
+ * Count the solutions of the finalised CSP problem.
+ * @param csp The CSP problem to solve.
+ * @param data The data to pass to the check function.
+ * @param solve_type The type of solving to use (FC, MAC, CBJ, OVARS, OVALS).
+ * @param stats The statistics of the count, NULL if not required.
+ * @return The number of solutions, 0 if an error occurred.
+ * @pre The csp library is initialised.
+ * @pre The CSP problem is finalised.
+ */
+extern uint64_t csp_problem_count_solutions(const CSPProblem *csp,
+	const void *data, SolveType solve_type, CSPSolveStats *stats
+);
@@ -12,6 +12,7 @@
 #include <assert.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -20,32 +21,85 @@
 #include "core/csp-lib.h"
 #include "solver/types-and-structs.h"
 
+#include "solver/csp-solver.inc.h"
+
+// PRIVATE
+// Remove the values of a variable which do not satisfy a constraint, false if
+// its domain is wiped out
+static bool filter_domain(size_t *values, const void *data, size_t variable,
+	const CSPConstraint *constraint, Domain **domains, DomainChange *change_stack,
+	size_t *stack_top
+){
+	size_t stack_start = *stack_top;
+	Domain *domain = domains[variable];
+	size_t amount = domain->amount;
+
+	if (domain_filter(domain, constraint, values, data, variable)) {
+		// Record the change in the stack
+		domain_change_stack_add(change_stack, stack_top, variable, amount);
+	}
+	if (domain->amount == 0) {
+		// Restore domains from the stack
+		domain_change_stack_restore(change_stack, stack_top, &stack_start,
+			domains
+		);
+		return false;
+	}
+	return true;
+}
+
+// PUBLIC
 bool csp_problem_forward_check(const CSPProblem *csp, size_t *values,
 	const void *data, size_t index,
 	FilledVariables *fv,
-	CSPValueChecklist *checklist, Domain **domains,
-	DomainChange *change_stack, size_t *stack_top
+	CSPValueChecklist *checklist, CSPConstraint **checks, Domain **domains,
+	DomainChange *change_stack, size_t *stack_top, CSPConstraint **wipeout
 ){
 	assert(csp_initialised());
+	assert(checklist == NULL || checks != NULL);
 
-	CSPConstraint **variable_checks =
-		malloc(sizeof(CSPConstraint *) * csp_problem_get_num_constraints(csp));
-	if (variable_checks == NULL) {
-		perror("malloc");
-		return false;
+	// Only the neighbours of the variable in the constraints index can lose
+	// values, a constraint being checked once all its other variables are
+	// filled
+	if (checklist == NULL) {
+		size_t amount;
+		CSPConstraint *const *constraints = csp_problem_get_variable_constraints(
+			csp, index, &amount
+		);
+
+		for (size_t k = 0; k < amount; k++) {
+			size_t variable = csp_solver_last_unfilled(constraints[k], index, fv);
+			if (variable == SIZE_MAX) {
+				continue;
+			}
+
+			if (!filter_domain(values, data, variable, constraints[k], domains,
+				change_stack, stack_top
+			)) {
+				if (wipeout != NULL) {
+					*wipeout = constraints[k];
+				}
+				return false;
+			}
+		}
+
+		return true;
 	}
 
 	for (size_t i = 0; i < fv->size; i++) {
 		if (!filled_variables_is_filled(fv, i)) {
 			size_t v_amount = 0;
-			checklist(csp, variable_checks, &v_amount, i, fv);
+			checklist(csp, checks, &v_amount, i, fv);
 
 			CSPConstraint *relevant_check = NULL;
 			for (size_t check_i = 0; check_i < v_amount; check_i++) {
-				size_t var0 = csp_constraint_get_variable(variable_checks[check_i], 0);
-				size_t var1 = csp_constraint_get_variable(variable_checks[check_i], 1);
+				if (csp_constraint_get_arity(checks[check_i]) != 2) {
+					continue;
+				}
+				size_t var0 = csp_constraint_get_variable(checks[check_i], 0);
+				size_t var1 = csp_constraint_get_variable(checks[check_i], 1);
 				if ((var0 == index && var1 == i) || (var1 == index && var0 == i)) {
-					relevant_check = variable_checks[check_i];
+					relevant_check = checks[check_i];
 					break;
 				}
 			}
@@ -54,42 +108,16 @@ bool csp_problem_forward_check(const CSPProblem *csp, size_t *values,
 				continue;
 			}
 
-			size_t stack_start = *stack_top;
-
-			for (size_t j = 0; j < domains[i]->amount;){
-				values[i] = domains[i]->values[j];
-
-				if (!csp_constraint_get_check(relevant_check)(
-					relevant_check, values, data
-				)){
-					// Record the change in the stack
-					domain_change_stack_add(change_stack, stack_top, i,
-						domains[i]->values[j]
-					);
-
-					// Remove the value from the domain
-					domains[i]->amount--;
-					for (size_t k = j; k < domains[i]->amount; k++) {
-						domains[i]->values[k] = domains[i]->values[k + 1];
-					}
-					// Do not increment j, as the next value is now at the same
-					// index
-				} else {
-					j++;	// Increment only if no value was removed
+			if (!filter_domain(values, data, i, relevant_check, domains,
+				change_stack, stack_top
+			)) {
+				if (wipeout != NULL) {
+					*wipeout = relevant_check;
 				}
-			}
-
-			if (domains[i]->amount == 0) {
-				// Restore domains from the stack
-				domain_change_stack_restore(change_stack,
-					stack_top, &stack_start, domains
-				);
-				free(variable_checks);
 				return false;
 			}
 		}
 	}
 
-	free(variable_checks);
 	return true;
 }
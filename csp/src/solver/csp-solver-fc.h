@@ -21,21 +21,33 @@
 
 /**
  * Forward check the CSP problem. Updates the domains of the variables
+ * constrained with the current one.
+ * Without a checklist, only the constraints of the current variable are
+ * visited, and each one whose other variables are all filled but one filters
+ * the domain of that variable, whatever its arity.
  * @param csp The CSP problem to check.
  * @param values The values of the variables.
  * @param data The data to pass to the check function.
  * @param index The index of the current variable.
  * @param fv The filled variables structure to track filled variables.
  * @param checklist A pointer to function to get the list of necessary
- * constraints for the current variable.
+ * constraints for each unfilled variable, the first binary one linking it to
+ * the current variable filtering its domain, or NULL to use the constraints
+ * index of the finalised CSP problem.
+ * @param checks The buffer receiving the constraints of the checklist, of at
+ * least csp->num_constraints entries, unused if checklist is NULL.
  * @param domains The domains of the variables.
  * @param change_stack The stack of changes made during forward checking.
  * @param stack_top The top of the change stack.
+ * @param wipeout Pointer receiving the constraint which wiped a domain out,
+ * NULL if not needed.
  * @return true if the CSP problem is consistent, false otherwise.
  * @pre The csp library is initialised.
+ * @pre checklist != NULL or the CSP problem is finalised.
  */
 extern bool csp_problem_forward_check(const CSPProblem *csp, size_t *values,
 	const void *data, size_t index,
-	FilledVariables* fv, CSPValueChecklist *checklist, Domain **domains,
-	DomainChange *change_stack, size_t *stack_top
+	FilledVariables* fv, CSPValueChecklist *checklist, CSPConstraint **checks,
+	Domain **domains,
+	DomainChange *change_stack, size_t *stack_top, CSPConstraint **wipeout
 );
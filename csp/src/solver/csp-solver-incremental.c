@@ -0,0 +1,117 @@
+/**
+ * @file csp-solver-incremental.c
+ * Library CSP incremental solving under assumptions
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#include "solver/csp-solver-incremental.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "core/csp-lib.h"
+#include "core/csp-problem.h"
+#include "solver/csp-solver.h"
+#include "solver/types-and-structs.h"
+
+#include "solver/csp-solver.inc.h"
+
+// PRIVATE
+// Add an assumption, forgetting the nogoods which relied on the previous ones
+static bool csp_solver_add_assumption(CSPSolver *solver, size_t variable,
+	size_t value, bool fixed
+){
+	assert(csp_initialised());
+	assert(variable < solver->num_domains);
+	assert(value < csp_problem_get_domain(solver->csp, variable));
+
+	if (solver->num_assumptions == solver->assumptions_capacity) {
+		size_t capacity = solver->assumptions_capacity > 0
+			? 2 * solver->assumptions_capacity : 16;
+		CSPSolverAssumption *assumptions = realloc(solver->assumptions,
+			capacity * sizeof(CSPSolverAssumption)
+		);
+		if (assumptions == NULL) {
+			perror("realloc");
+			return false;
+		}
+		solver->assumptions = assumptions;
+		solver->assumptions_capacity = capacity;
+	}
+
+	if (solver->nogoods_assumed) {
+		csp_solver_clear_nogoods(solver);
+		solver->nogoods_assumed = false;
+	}
+
+	solver->assumptions[solver->num_assumptions++] = (CSPSolverAssumption) {
+		.variable = variable,
+		.value = value,
+		.fixed = fixed
+	};
+	return true;
+}
+
+// PUBLIC
+// Setters
+void csp_solver_set_incremental(CSPSolver *solver, bool incremental){
+	assert(csp_initialised());
+
+	solver->incremental = incremental;
+	solver->root_ready = false;
+}
+
+bool csp_solver_assume(CSPSolver *solver, size_t variable, size_t value){
+	return csp_solver_add_assumption(solver, variable, value, true);
+}
+
+bool csp_solver_assume_not(CSPSolver *solver, size_t variable, size_t value){
+	return csp_solver_add_assumption(solver, variable, value, false);
+}
+
+void csp_solver_retract(CSPSolver *solver){
+	assert(csp_initialised());
+
+	if (solver->nogoods_assumed) {
+		csp_solver_clear_nogoods(solver);
+		solver->nogoods_assumed = false;
+	}
+	solver->num_assumptions = 0;
+}
+
+// Functions
+bool csp_solver_apply_assumptions(CSPSolver *solver){
+	for (size_t i = 0; i < solver->num_assumptions; i++) {
+		const CSPSolverAssumption *assumption = &solver->assumptions[i];
+		Domain *domain = solver->domains[assumption->variable];
+		size_t amount = domain->amount;
+
+		if (assumption->fixed) {
+			// Remove the other values, from the last one so that a removed value
+			// is swapped with an already kept one
+			for (size_t j = amount; j-- > 0;) {
+				if (domain->values[j] != assumption->value) {
+					domain_remove(domain, domain->values[j]);
+				}
+			}
+		} else if (domain_contains(domain, assumption->value)) {
+			domain_remove(domain, assumption->value);
+		}
+
+		if (domain->amount < amount) {
+			domain_change_stack_add(solver->change_stack, &solver->stack_top,
+				assumption->variable, amount
+			);
+		}
+		if (domain->amount == 0) {
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file csp-solver-incremental.h
+ * Library CSP incremental solving under assumptions
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#pragma once
+
+#if !defined (_CSP_H_INSIDE) && !defined (CSP_COMPILATION)
+#error "Only <csp/csp.h> can be included directly."
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "solver/csp-solver.h"
+
+/**
+ * Make the solver keep the root of its search between solves. The domains
+ * reduced by the data and made arc consistent by MAC, the weights of the
+ * constraints and the nogoods learnt without assumptions are kept, the
+ * following solves starting from them instead of the domains of the CSP
+ * problem.
+ * @param solver The solver.
+ * @param incremental Whether the root is kept, false by default.
+ * @pre The csp library is initialised.
+ * @pre The data reducing the domains does not change between the solves of an
+ * incremental solver.
+ * @note The root is reduced again if the solve type changes from or to MAC, or
+ * if the data checklist changes.
+ */
+extern void csp_solver_set_incremental(CSPSolver *solver, bool incremental);
+
+/**
+ * Assume that a variable takes a value in the next solves of the solver.
+ * @param solver The solver.
+ * @param variable The index of the variable.
+ * @param value The value.
+ * @return true if the assumption was added, false if an error occurred.
+ * @pre The csp library is initialised.
+ * @pre variable and value are in the CSP problem bound to the solver.
+ * @post The solves only search the solutions taking the value.
+ */
+extern bool csp_solver_assume(CSPSolver *solver, size_t variable,
+	size_t value
+);
+
+/**
+ * Assume that a variable does not take a value in the next solves of the
+ * solver.
+ * @param solver The solver.
+ * @param variable The index of the variable.
+ * @param value The value.
+ * @return true if the assumption was added, false if an error occurred.
+ * @pre The csp library is initialised.
+ * @pre variable and value are in the CSP problem bound to the solver.
+ * @post The solves only search the solutions not taking the value.
+ */
+extern bool csp_solver_assume_not(CSPSolver *solver, size_t variable,
+	size_t value
+);
+
+/**
+ * Retract every assumption of the solver.
+ * @param solver The solver.
+ * @pre The csp library is initialised.
+ * @post The nogoods learnt under the assumptions are forgotten.
+ */
+extern void csp_solver_retract(CSPSolver *solver);
@@ -0,0 +1,616 @@
+/**
+ * @file csp-solver-mac.c
+ * Library CSP maintaining arc consistency
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#include "solver/csp-solver-mac.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "core/csp-constraint.h"
+#include "core/csp-constraint-table.h"
+#include "core/csp-lib.h"
+#include "core/csp-problem.h"
+#include "solver/types-and-structs.h"
+#include "util/stats.h"
+
+#include "solver/csp-solver.inc.h"
+
+// Maximum number of residues a solver allocates
+#define MAX_RESIDUES ((size_t) 1 << 22)
+
+// PRIVATE
+// Push a variable in the propagation queue if it is not already in it
+static void queue_push(CSPSolver *solver, size_t *tail, size_t *count,
+	size_t variable
+){
+	if (solver->queued[variable]) {
+		return;
+	}
+	solver->queued[variable] = true;
+	solver->queue[*tail] = variable;
+	*tail = (*tail + 1) % solver->num_domains;
+	(*count)++;
+}
+
+// Empty the propagation queue for the next propagation
+static void queue_clear(CSPSolver *solver, size_t *head, size_t *count){
+	while (*count > 0) {
+		solver->queued[solver->queue[*head]] = false;
+		*head = (*head + 1) % solver->num_domains;
+		(*count)--;
+	}
+}
+
+// Find a value of the domain of x supporting the value of y
+static bool find_support(CSPSolver *solver, size_t *values, const void *data,
+	const CSPConstraint *constraint, size_t x, size_t *residue
+){
+	CSPChecker *check = csp_constraint_get_check(constraint);
+	const Domain *domain = solver->domains[x];
+
+	// The last support found is still one if it is left
+	if (residue != NULL && *residue != SIZE_MAX
+		&& domain_contains(domain, *residue)
+	) {
+		return true;
+	}
+
+	for (size_t j = 0; j < domain->amount; j++) {
+		values[x] = domain->values[j];
+		STATS(stats_counters.checks++);
+		if (check(constraint, values, data)) {
+			if (residue != NULL) {
+				*residue = values[x];
+			}
+			return true;
+		}
+	}
+	return false;
+}
+
+// Revise the domain of y against the binary constraint linking it to x
+static bool revise_binary(CSPSolver *solver, size_t *values, const void *data,
+	const CSPConstraint *constraint, size_t x, size_t y, size_t arc_y,
+	size_t arc_x
+){
+	Domain *domain = solver->domains[y];
+
+	// A filled variable leaves a single support to check for each value
+	if (filled_variables_is_filled(solver->fv, x)) {
+		return domain_filter(domain, constraint, values, data, y);
+	}
+
+	size_t *residues_y = NULL;
+	size_t *residues_x = NULL;
+	if (solver->num_residues > 0) {
+		residues_y = &solver->residues[solver->residue_offsets[arc_y]];
+		residues_x = &solver->residues[solver->residue_offsets[arc_x]];
+	}
+
+	size_t value_x = values[x];
+	bool removed = false;
+
+	// Filter the values left, from the last one so that a removed value is
+	// swapped with an already checked one
+	for (size_t j = domain->amount; j-- > 0;) {
+		values[y] = domain->values[j];
+
+		bool supported = find_support(solver, values, data, constraint, x,
+			residues_y != NULL ? &residues_y[values[y]] : NULL
+		);
+		// The support is mutual, store it for the mirror arc
+		if (supported && residues_x != NULL) {
+			residues_x[residues_y[values[y]]] = values[y];
+		}
+
+		if (!supported) {
+			domain_remove(domain, values[y]);
+			removed = true;
+		}
+	}
+
+	values[x] = value_x;
+	return removed;
+}
+
+// Record the word or the size of a slot of a current table before changing it
+static void table_save(CSPSolver *solver, size_t index, size_t slot,
+	uint64_t value
+){
+	CSPSolverTableChange *change = &solver->table_trail[solver->table_top++];
+	change->table = index;
+	change->slot = slot;
+	change->value = value;
+}
+
+// Set the size of the domain of a variable at the last revision of a table
+static void table_set_size(CSPSolver *solver, size_t index, size_t i,
+	size_t size
+){
+	CSPSolverTable *table = &solver->tables[index];
+	if (table->sizes[i] != size) {
+		table_save(solver, index, table->num_words + i, table->sizes[i]);
+		table->sizes[i] = size;
+	}
+}
+
+// Add the tuples of a set to the mask, on the non-zero words only
+static void table_add_to_mask(CSPSolver *solver, const CSPSolverTable *table,
+	const uint64_t *set
+){
+	if (set == NULL) {
+		return;
+	}
+	for (size_t k = 0; k < table->limit; k++) {
+		size_t w = table->index[k];
+		solver->table_mask[w] |= set[w];
+	}
+}
+
+// Keep the tuples of a current table which are in the mask, or which are not
+// in it if inverse, a word becoming zero leaving the non-zero ones
+static void table_intersect(CSPSolver *solver, size_t index, bool inverse){
+	CSPSolverTable *table = &solver->tables[index];
+
+	// From the last non-zero word, so that a word becoming zero is swapped with
+	// an already intersected one
+	for (size_t k = table->limit; k-- > 0;) {
+		size_t w = table->index[k];
+		uint64_t mask = inverse ? ~solver->table_mask[w] : solver->table_mask[w];
+		uint64_t word = table->words[w] & mask;
+		if (word == table->words[w]) {
+			continue;
+		}
+
+		table_save(solver, index, w, table->words[w]);
+		table->words[w] = word;
+		if (word == 0) {
+			table->index[k] = table->index[--table->limit];
+			table->index[table->limit] = w;
+		}
+	}
+}
+
+// Find a tuple of a current table in a set, starting from the last one found
+static bool table_supported(const CSPSolverTable *table, const uint64_t *set,
+	size_t *residue
+){
+	if (set == NULL) {
+		return false;
+	}
+	if (table->words[*residue] & set[*residue]) {
+		return true;
+	}
+	for (size_t k = 0; k < table->limit; k++) {
+		size_t w = table->index[k];
+		if (table->words[w] & set[w]) {
+			*residue = w;
+			return true;
+		}
+	}
+	return false;
+}
+
+// Revise the domains of the unfilled variables of a table constraint of
+// allowed tuples by Compact-Table filtering, false if a domain is wiped out
+static bool revise_table(CSPSolver *solver, const size_t *values,
+	size_t index, size_t *tail, size_t *count
+){
+	CSPSolverTable *table = &solver->tables[index];
+	const CSPConstraint *constraint = table->constraint;
+	size_t arity = csp_constraint_get_arity(constraint);
+	size_t num_changed = 0;
+	size_t changed = SIZE_MAX;
+
+	// Remove from the current table the tuples of the values removed since the
+	// last revision, from the removed values if they are fewer than the values
+	// left and from the values left otherwise
+	for (size_t i = 0; i < arity && table->limit > 0; i++) {
+		size_t variable = csp_constraint_get_variable(constraint, i);
+		const Domain *domain = solver->domains[variable];
+		bool filled = filled_variables_is_filled(solver->fv, variable);
+		size_t size = filled ? 0 : domain->amount;
+		size_t last = table->sizes[i];
+		if (size == last) {
+			continue;
+		}
+		num_changed++;
+		changed = i;
+
+		for (size_t k = 0; k < table->limit; k++) {
+			solver->table_mask[table->index[k]] = 0;
+		}
+		if (filled) {
+			// A filled variable only keeps the tuples of its value
+			table_add_to_mask(solver, table, csp_constraint_get_table_supports(
+				constraint, i, values[variable]
+			));
+			table_intersect(solver, index, false);
+		} else if (last - size < size) {
+			// The removed values are kept after the values left
+			for (size_t j = size; j < last; j++) {
+				table_add_to_mask(solver, table, csp_constraint_get_table_supports(
+					constraint, i, domain->values[j]
+				));
+			}
+			table_intersect(solver, index, true);
+		} else {
+			for (size_t j = 0; j < size; j++) {
+				table_add_to_mask(solver, table, csp_constraint_get_table_supports(
+					constraint, i, domain->values[j]
+				));
+			}
+			table_intersect(solver, index, false);
+		}
+		table_set_size(solver, index, i, size);
+	}
+	if (table->limit == 0) {
+		return false;
+	}
+
+	// Each value left needs a tuple of the current table, but for the only
+	// variable which changed, whose values left keep their tuples
+	size_t *residues = table->residues;
+	for (size_t i = 0; i < arity; i++) {
+		size_t variable = csp_constraint_get_variable(constraint, i);
+		Domain *domain = solver->domains[variable];
+		size_t before = domain->amount;
+		if (filled_variables_is_filled(solver->fv, variable)
+			|| (num_changed == 1 && changed == i)
+		) {
+			residues += solver->capacities[variable];
+			continue;
+		}
+
+		for (size_t j = domain->amount; j-- > 0;) {
+			size_t value = domain->values[j];
+			if (!table_supported(table, csp_constraint_get_table_supports(
+				constraint, i, value
+			), &residues[value])) {
+				domain_remove(domain, value);
+			}
+		}
+		residues += solver->capacities[variable];
+
+		if (domain->amount < before) {
+			domain_change_stack_add(solver->change_stack, &solver->stack_top,
+				variable, before
+			);
+			if (domain->amount == 0) {
+				return false;
+			}
+			table_set_size(solver, index, i, domain->amount);
+			queue_push(solver, tail, count, variable);
+		}
+	}
+	return true;
+}
+
+// INTERNAL
+void csp_solver_prepare_residues(CSPSolver *solver){
+	if (solver->num_arcs == 0) {
+		return;
+	}
+
+	if (!solver->residues_indexed) {
+		if (solver->residue_offsets == NULL) {
+			solver->residue_offsets = malloc(
+				solver->arc_capacity * sizeof(size_t)
+			);
+			if (solver->residue_offsets == NULL) {
+				perror("malloc");
+				return;
+			}
+		}
+
+		// Only binary constraint arcs have residues, one per value
+		size_t total = 0;
+		for (size_t i = 0; i < solver->num_domains; i++) {
+			for (size_t arc = solver->arc_bases[i];
+				arc < solver->arc_bases[i + 1]; arc++
+			) {
+				solver->residue_offsets[arc] = total;
+				if (solver->arc_mirrors[arc] != SIZE_MAX) {
+					total += solver->capacities[i];
+				}
+			}
+		}
+
+		if (total > 0 && total <= MAX_RESIDUES
+			&& total > solver->residue_capacity
+		) {
+			free(solver->residues);
+			solver->residue_capacity = 0;
+			solver->residues = malloc(total * sizeof(size_t));
+			if (solver->residues == NULL) {
+				perror("malloc");
+				return;
+			}
+			solver->residue_capacity = total;
+		}
+		solver->num_residues = total <= MAX_RESIDUES ? total : 0;
+		solver->residues_indexed = true;
+	}
+
+	// The constraints may depend on data, the supports of a solve do not hold
+	// for the next one
+	for (size_t i = 0; i < solver->num_residues; i++) {
+		solver->residues[i] = SIZE_MAX;
+	}
+}
+
+bool csp_solver_index_tables(CSPSolver *solver){
+	const CSPProblem *csp = solver->csp;
+	size_t num_constraints = csp_problem_get_num_constraints(csp);
+	size_t num_tables = 0;
+	size_t max_words = 0;
+	size_t trail = 0;
+
+	// Along a branch, a word of a current table only loses tuples and a size
+	// only decreases, which bounds the changes of the trail
+	for (size_t i = 0; i < num_constraints; i++) {
+		const CSPConstraint *constraint = csp_problem_get_constraint(csp, i);
+		if (!csp_constraint_is_table(constraint)
+			|| !csp_constraint_get_table_allowed(constraint)
+		) {
+			continue;
+		}
+
+		size_t num_words = csp_constraint_get_table_words(constraint);
+		if (num_words > max_words) {
+			max_words = num_words;
+		}
+		trail += 64 * num_words;
+		for (size_t k = 0; k < csp_constraint_get_arity(constraint); k++) {
+			trail += solver->capacities[csp_constraint_get_variable(constraint,
+				k
+			)] + 2;
+		}
+		num_tables++;
+	}
+	if (num_tables == 0) {
+		return true;
+	}
+
+	solver->tables = calloc(num_tables, sizeof(CSPSolverTable));
+	solver->table_ids = malloc(num_constraints * sizeof(size_t));
+	solver->table_mask = malloc(
+		(max_words > 0 ? max_words : 1) * sizeof(uint64_t)
+	);
+	solver->table_trail = malloc(trail * sizeof(CSPSolverTableChange));
+	if (solver->tables == NULL || solver->table_ids == NULL
+		|| solver->table_mask == NULL || solver->table_trail == NULL
+	) {
+		return false;
+	}
+	solver->num_tables = num_tables;
+
+	size_t index = 0;
+	for (size_t i = 0; i < num_constraints; i++) {
+		const CSPConstraint *constraint = csp_problem_get_constraint(csp, i);
+		solver->table_ids[i] = SIZE_MAX;
+		if (!csp_constraint_is_table(constraint)
+			|| !csp_constraint_get_table_allowed(constraint)
+		) {
+			continue;
+		}
+
+		CSPSolverTable *table = &solver->tables[index];
+		size_t arity = csp_constraint_get_arity(constraint);
+		size_t num_values = 0;
+		for (size_t k = 0; k < arity; k++) {
+			num_values += solver->capacities[csp_constraint_get_variable(
+				constraint, k
+			)];
+		}
+
+		table->constraint = constraint;
+		table->num_words = csp_constraint_get_table_words(constraint);
+		table->words = malloc(
+			(table->num_words > 0 ? table->num_words : 1) * sizeof(uint64_t)
+		);
+		table->index = malloc(
+			(table->num_words > 0 ? table->num_words : 1) * sizeof(size_t)
+		);
+		table->sizes = malloc(arity * sizeof(size_t));
+		table->residues = calloc(num_values > 0 ? num_values : 1,
+			sizeof(size_t)
+		);
+		if (table->words == NULL || table->index == NULL || table->sizes == NULL
+			|| table->residues == NULL
+		) {
+			return false;
+		}
+		solver->table_ids[i] = index++;
+	}
+
+	return true;
+}
+
+void csp_solver_free_tables(CSPSolver *solver){
+	if (solver->tables != NULL) {
+		for (size_t i = 0; i < solver->num_tables; i++) {
+			free(solver->tables[i].words);
+			free(solver->tables[i].index);
+			free(solver->tables[i].sizes);
+			free(solver->tables[i].residues);
+		}
+	}
+	free(solver->tables);
+	free(solver->table_ids);
+	free(solver->table_mask);
+	free(solver->table_trail);
+	solver->tables = NULL;
+	solver->table_ids = NULL;
+	solver->table_mask = NULL;
+	solver->table_trail = NULL;
+	solver->num_tables = 0;
+	solver->table_top = 0;
+	solver->root_table_top = 0;
+	solver->base_table_top = 0;
+}
+
+void csp_solver_prepare_tables(CSPSolver *solver){
+	for (size_t i = 0; i < solver->num_tables; i++) {
+		CSPSolverTable *table = &solver->tables[i];
+		size_t arity = csp_constraint_get_arity(table->constraint);
+
+		// Every tuple has a value for the first variable
+		for (size_t w = 0; w < table->num_words; w++) {
+			table->words[w] = 0;
+			table->index[w] = w;
+		}
+		for (size_t value = 0;; value++) {
+			const uint64_t *set = csp_constraint_get_table_supports(
+				table->constraint, 0, value
+			);
+			if (set == NULL) {
+				break;
+			}
+			for (size_t w = 0; w < table->num_words; w++) {
+				table->words[w] |= set[w];
+			}
+		}
+		table->limit = table->num_words;
+
+		for (size_t k = 0; k < arity; k++) {
+			table->sizes[k] = SIZE_MAX;
+		}
+	}
+	solver->table_top = 0;
+}
+
+void csp_solver_restore_tables(CSPSolver *solver, size_t top){
+	while (solver->table_top > top) {
+		const CSPSolverTableChange *change
+			= &solver->table_trail[--solver->table_top];
+		CSPSolverTable *table = &solver->tables[change->table];
+
+		if (change->slot >= table->num_words) {
+			table->sizes[change->slot - table->num_words] = change->value;
+			continue;
+		}
+
+		// The words become non-zero again in the reverse order they became zero
+		if (table->words[change->slot] == 0) {
+			assert(table->index[table->limit] == change->slot);
+			table->limit++;
+		}
+		table->words[change->slot] = change->value;
+	}
+}
+
+// PUBLIC
+bool csp_solver_maintain_arc_consistency(CSPSolver *solver, size_t *values,
+	const void *data, size_t index
+){
+	assert(csp_initialised());
+	assert(csp_problem_is_finalised(solver->csp));
+
+	const CSPProblem *csp = solver->csp;
+	size_t head = 0;
+	size_t tail = 0;
+	size_t count = 0;
+
+	if (index == SIZE_MAX) {
+		for (size_t i = 0; i < solver->num_domains; i++) {
+			queue_push(solver, &tail, &count, i);
+		}
+	} else {
+		queue_push(solver, &tail, &count, index);
+	}
+
+	while (count > 0) {
+		size_t x = solver->queue[head];
+		head = (head + 1) % solver->num_domains;
+		count--;
+		solver->queued[x] = false;
+
+		size_t amount;
+		CSPConstraint *const *constraints = csp_problem_get_variable_constraints(
+			csp, x, &amount
+		);
+		const size_t *ids = csp_problem_get_variable_constraint_ids(csp, x,
+			&amount
+		);
+
+		for (size_t k = 0; k < amount; k++) {
+			const CSPConstraint *constraint = constraints[k];
+			size_t arc_x = solver->arc_bases[x] + k;
+			size_t arc_y = solver->arc_mirrors[arc_x];
+			size_t y;
+			bool removed;
+
+			size_t table = solver->num_tables > 0 ? solver->table_ids[ids[k]]
+				: SIZE_MAX;
+			if (table != SIZE_MAX) {
+				if (!revise_table(solver, values, table, &tail, &count)) {
+					solver->weights[ids[k]]++;
+					queue_clear(solver, &head, &count);
+					return false;
+				}
+				continue;
+			}
+
+			if (arc_y != SIZE_MAX) {
+				y = csp_constraint_get_variable(constraint, 0);
+				if (y == x) {
+					y = csp_constraint_get_variable(constraint, 1);
+				}
+				if (filled_variables_is_filled(solver->fv, y)) {
+					continue;
+				}
+
+				size_t before = solver->domains[y]->amount;
+				removed = revise_binary(solver, values, data, constraint, x, y,
+					arc_y, arc_x
+				);
+				if (removed) {
+					domain_change_stack_add(solver->change_stack, &solver->stack_top,
+						y, before
+					);
+				}
+			} else {
+				if (csp_constraint_get_arity(constraint) < 2) {
+					continue;
+				}
+				y = csp_solver_last_unfilled(constraint, SIZE_MAX, solver->fv);
+				if (y == SIZE_MAX) {
+					continue;
+				}
+
+				size_t before = solver->domains[y]->amount;
+				removed = domain_filter(solver->domains[y], constraint, values, data,
+					y
+				);
+				if (removed) {
+					domain_change_stack_add(solver->change_stack, &solver->stack_top,
+						y, before
+					);
+				}
+			}
+
+			if (removed) {
+				if (solver->domains[y]->amount == 0) {
+					solver->weights[ids[k]]++;
+
+					queue_clear(solver, &head, &count);
+					return false;
+				}
+				queue_push(solver, &tail, &count, y);
+			}
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,41 @@
+/**
+ * @file csp-solver-mac.h
+ * Library CSP maintaining arc consistency
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#pragma once
+
+#if !defined (_CSP_H_INSIDE) && !defined (CSP_COMPILATION)
+#error "Only <csp/csp.h> can be included directly."
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "solver/csp-solver.h"
+
+/**
+ * Propagate the constraints of the CSP problem bound to the solver until the
+ * domains of the unfilled variables are arc consistent. Binary constraints are
+ * revised with the last support found for each value, table constraints of
+ * allowed tuples by Compact-Table filtering, the other n-ary constraints are
+ * revised once a single of their variables is unfilled.
+ * Every change of the domains is recorded in the change stack of the solver,
+ * and every change of the current tables in its table trail.
+ * @param solver The solver.
+ * @param values The values of the variables.
+ * @param data The data to pass to the check function.
+ * @param index The index of the variable which was assigned, or SIZE_MAX to
+ * propagate the constraints of every variable.
+ * @return false if a domain was wiped out, true otherwise.
+ * @pre The csp library is initialised.
+ * @pre The CSP problem bound to the solver is finalised.
+ * @post On failure, the domains are left to be restored from the change stack.
+ */
+extern bool csp_solver_maintain_arc_consistency(CSPSolver *solver,
+	size_t *values, const void *data, size_t index
+);
@@ -0,0 +1,107 @@
+/**
+ * @file csp-solver-minimize.c
+ * Library CSP branch and bound minimization of an objective
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#include "solver/csp-solver-minimize.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "core/csp-lib.h"
+#include "core/csp-problem.h"
+#include "solver/csp-solver.h"
+#include "solver/csp-solver-enumerate.h"
+#include "solver/types-and-structs.h"
+
+#include "solver/csp-solver.inc.h"
+
+// PUBLIC
+// Functions
+bool csp_solver_minimize(CSPSolver *solver, size_t *values, const void *data,
+	SolveType solve_type, CSPValueChecklist *checklist,
+	CSPDataChecklist *dataChecklist, CSPObjective *objective,
+	CSPLowerBound *bound, CSPSolutionCallback *callback, void *arg,
+	double *cost, CSPSolveStats *stats
+){
+	assert(csp_initialised());
+	assert(checklist != NULL || csp_problem_is_finalised(solver->csp));
+	assert(!(solve_type & MAC) || csp_problem_is_finalised(solver->csp));
+	assert(!(solve_type & OVALS_SUPPORTS)
+		|| csp_problem_is_finalised(solver->csp)
+	);
+	assert(!(solve_type & OVARS_DOMWDEG)
+		|| csp_problem_is_finalised(solver->csp)
+	);
+	assert(solver->restart_type == RESTARTS_NONE);
+	assert(objective != NULL);
+
+	solver->enumerating = true;
+	solver->callback = callback;
+	solver->callback_arg = arg;
+	solver->objective = objective;
+	solver->bound = bound;
+	solver->best_cost = INFINITY;
+
+	// The search only returns true if the callback stopped it
+	bool stopped = false;
+	if (csp_solver_prepare(solver, values, data, solve_type, dataChecklist)) {
+		stopped = csp_solver_search(solver, values, data, solve_type, checklist,
+			NULL, 0
+		);
+	}
+
+	solver->enumerating = false;
+	solver->callback = NULL;
+	solver->callback_arg = NULL;
+	solver->objective = NULL;
+	solver->bound = NULL;
+
+	bool result = solver->best_cost < INFINITY;
+	if (result) {
+		memcpy(values, solver->best, solver->num_domains * sizeof(size_t));
+		if (cost != NULL) {
+			*cost = solver->best_cost;
+		}
+	}
+
+	if (solver->interrupted || stopped) {
+		solver->outcome = OUTCOME_UNKNOWN;
+	} else {
+		solver->outcome = result ? OUTCOME_SAT : OUTCOME_UNSAT;
+	}
+	if (stats != NULL) {
+		*stats = solver->stats;
+	}
+
+	return result;
+}
+
+bool csp_problem_minimize(const CSPProblem *csp, size_t *values,
+	const void *data, SolveType solve_type, CSPValueChecklist *checklist,
+	CSPDataChecklist *dataChecklist, CSPObjective *objective,
+	CSPLowerBound *bound, CSPSolutionCallback *callback, void *arg,
+	double *cost, CSPSolveStats *stats
+){
+	assert(csp_initialised());
+
+	CSPSolver *solver = csp_solver_create(csp);
+	if (solver == NULL) {
+		return false;
+	}
+
+	bool result = csp_solver_minimize(solver, values, data, solve_type,
+		checklist, dataChecklist, objective, bound, callback, arg, cost, stats
+	);
+
+	csp_solver_destroy(solver);
+
+	return result;
+}
@@ -0,0 +1,119 @@
+/**
+ * @file csp-solver-minimize.h
+ * Library CSP branch and bound minimization of an objective
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#pragma once
+
+#if !defined (_CSP_H_INSIDE) && !defined (CSP_COMPILATION)
+#error "Only <csp/csp.h> can be included directly."
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "core/csp-problem.h"
+#include "solver/csp-solver.h"
+#include "solver/csp-solver-enumerate.h"
+#include "solver/types-and-structs.h"
+
+/**
+ * Get the objective of a solution.
+ * @param values The values of the variables, all assigned.
+ * @param data The data passed to the solver.
+ * @return The objective, finite.
+ */
+typedef double CSPObjective(const size_t *values, const void *data);
+
+/**
+ * Get a lower bound of the objective of the solutions below a node of the
+ * search.
+ * @param values The values of the variables, only the filled ones being
+ * assigned.
+ * @param fv The filled variables.
+ * @param domains The domains left of the variables.
+ * @param data The data passed to the solver.
+ * @return A lower bound of the objective of every solution extending the
+ * assignment of the filled variables within the domains.
+ */
+typedef double CSPLowerBound(const size_t *values, const FilledVariables *fv,
+	Domain *const *domains, const void *data
+);
+
+/**
+ * Minimize an objective over the solutions of the CSP problem bound to the
+ * solver by branch and bound. The search goes on after each solution, and
+ * gives up the subtrees whose lower bound is not lower than the objective of
+ * the best solution found.
+ * @param solver The solver to use.
+ * @param values The values of the variables.
+ * @param data The data to pass to the check functions and the callbacks.
+ * @param solve_type The type of solving to use (FC, MAC, CBJ, OVARS, OVALS).
+ * @param checklist A pointer to function to get the list of necessary
+ * constraints for the current variable, or NULL to use the constraints index
+ * of the finalised CSP problem.
+ * @param dataChecklist A pointer to function to get the list of constraints
+ * affected by the contents of data for the current variable, or NULL to use
+ * the unary constraints of the finalised CSP problem.
+ * @param objective The objective to minimize.
+ * @param bound The lower bound of the objective, NULL to prune no subtree.
+ * @param callback The callback receiving each solution improving the best one,
+ * NULL if not required.
+ * @param arg The argument to pass to the callback.
+ * @param cost The objective of the best solution, NULL if not required.
+ * @param stats The statistics of the minimization, NULL if not required.
+ * @return true if a solution was found, false otherwise.
+ * @pre The csp library is initialised.
+ * @pre checklist != NULL or the CSP problem is finalised.
+ * @pre The CSP problem is finalised if solve_type has MAC, OVALS_SUPPORTS or
+ * OVARS_DOMWDEG.
+ * @pre The solver does not restart.
+ * @post The values are assigned to the best solution found, which is optimal
+ * if csp_solver_get_outcome is OUTCOME_SAT. It is OUTCOME_UNKNOWN if a limit,
+ * the cancel flag or the callback stopped the search.
+ */
+extern bool csp_solver_minimize(CSPSolver *solver, size_t *values,
+	const void *data, SolveType solve_type, CSPValueChecklist *checklist,
+	CSPDataChecklist *dataChecklist, CSPObjective *objective,
+	CSPLowerBound *bound, CSPSolutionCallback *callback, void *arg,
+	double *cost, CSPSolveStats *stats
+);
+
+/**
+ * Minimize an objective over the solutions of the CSP problem by branch and
+ * bound.
+ * @param csp The CSP problem to solve.
+ * @param values The values of the variables.
+ * @param data The data to pass to the check functions and the callbacks.
+ * @param solve_type The type of solving to use (FC, MAC, CBJ, OVARS, OVALS).
+ * @param checklist A pointer to function to get the list of necessary
+ * constraints for the current variable, or NULL to use the constraints index
+ * of the finalised CSP problem.
+ * @param dataChecklist A pointer to function to get the list of constraints
+ * affected by the contents of data for the current variable, or NULL to use
+ * the unary constraints of the finalised CSP problem.
+ * @param objective The objective to minimize.
+ * @param bound The lower bound of the objective, NULL to prune no subtree.
+ * @param callback The callback receiving each solution improving the best one,
+ * NULL if not required.
+ * @param arg The argument to pass to the callback.
+ * @param cost The objective of the best solution, NULL if not required.
+ * @param stats The statistics of the minimization, NULL if not required.
+ * @return true if a solution was found, false otherwise.
+ * @pre The csp library is initialised.
+ * @pre checklist != NULL or the CSP problem is finalised.
+ * @pre The CSP problem is finalised if solve_type has MAC, OVALS_SUPPORTS or
+ * OVARS_DOMWDEG.
+ * @post The values are assigned to an optimal solution unless the callback
+ * stopped the search.
+ */
+extern bool csp_problem_minimize(const CSPProblem *csp, size_t *values,
+	const void *data, SolveType solve_type, CSPValueChecklist *checklist,
+	CSPDataChecklist *dataChecklist, CSPObjective *objective,
+	CSPLowerBound *bound, CSPSolutionCallback *callback, void *arg,
+	double *cost, CSPSolveStats *stats
+);
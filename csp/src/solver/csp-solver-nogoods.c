@@ -0,0 +1,226 @@
+/**
+ * @file csp-solver-nogoods.c
+ * Library CSP nogoods recorded from restarts
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "solver/types-and-structs.h"
+
+#include "solver/csp-solver.inc.h"
+
+// Maximum number of literals a solver records
+#define MAX_LITERALS ((size_t) 1 << 22)
+
+// PRIVATE
+// Verify if the variable of a literal is assigned its value
+static bool literal_is_satisfied(const CSPSolver *solver, const size_t *values,
+	const CSPSolverLiteral *literal
+){
+	return filled_variables_is_filled(solver->fv, literal->variable)
+		&& values[literal->variable] == literal->value;
+}
+
+// Remove a value from the domain of a variable, recording the change
+static bool remove_value(CSPSolver *solver, size_t variable, size_t value){
+	Domain *domain = solver->domains[variable];
+
+	if (domain_contains(domain, value)) {
+		domain_change_stack_add(solver->change_stack, &solver->stack_top,
+			variable, domain->amount
+		);
+		domain_remove(domain, value);
+	}
+	return domain->amount > 0;
+}
+
+// Make room for a nogood of the specified number of literals
+static bool reserve_nogood(CSPSolver *solver, size_t amount){
+	if (solver->num_literals + amount > MAX_LITERALS) {
+		return false;
+	}
+
+	if (solver->num_literals + amount > solver->literals_capacity) {
+		size_t capacity = solver->literals_capacity > 0
+			? solver->literals_capacity : 64;
+		while (capacity < solver->num_literals + amount) {
+			capacity *= 2;
+		}
+
+		CSPSolverLiteral *literals = realloc(solver->literals,
+			capacity * sizeof(CSPSolverLiteral)
+		);
+		if (literals == NULL) {
+			return false;
+		}
+		solver->literals = literals;
+		solver->literals_capacity = capacity;
+	}
+
+	if (solver->num_nogoods + 1 > solver->nogoods_capacity) {
+		size_t capacity = solver->nogoods_capacity > 0
+			? solver->nogoods_capacity * 2 : 16;
+
+		size_t *starts = realloc(solver->nogood_starts,
+			(capacity + 1) * sizeof(size_t)
+		);
+		if (starts == NULL) {
+			return false;
+		}
+		solver->nogood_starts = starts;
+
+		size_t *watches = realloc(solver->watches, 2 * capacity * sizeof(size_t));
+		if (watches == NULL) {
+			return false;
+		}
+		solver->watches = watches;
+
+		size_t *next = realloc(solver->watch_next, 2 * capacity * sizeof(size_t));
+		if (next == NULL) {
+			return false;
+		}
+		solver->watch_next = next;
+
+		solver->nogoods_capacity = capacity;
+	}
+
+	return true;
+}
+
+// Watch a literal of a nogood
+static void watch(CSPSolver *solver, size_t entry, size_t literal){
+	size_t variable = solver->literals[literal].variable;
+
+	solver->watches[entry] = literal;
+	solver->watch_next[entry] = solver->watch_heads[variable];
+	solver->watch_heads[variable] = entry;
+}
+
+// INTERNAL
+void csp_solver_clear_nogoods(CSPSolver *solver){
+	solver->num_literals = 0;
+	solver->num_nogoods = 0;
+	solver->num_units = 0;
+	if (solver->nogood_starts != NULL) {
+		solver->nogood_starts[0] = 0;
+	}
+	for (size_t i = 0; i < solver->num_domains; i++) {
+		solver->watch_heads[i] = SIZE_MAX;
+	}
+}
+
+void csp_solver_record_nogoods(CSPSolver *solver, const size_t *values){
+	// The nogoods only hold as long as the assumptions
+	if (solver->num_assumptions > 0) {
+		solver->nogoods_assumed = true;
+	}
+
+	for (size_t j = 0; j < solver->depth; j++) {
+		const CSPSolverFrame *frame = &solver->frames[j];
+		const Domain *domain = solver->domains[frame->index];
+
+		// The values before the one assigned were refuted, and so was the one
+		// assigned at the deepest decision
+		size_t refuted = j + 1 < solver->depth
+			? frame->position - 1 : frame->position;
+
+		for (size_t r = 0; r < refuted; r++) {
+			CSPSolverLiteral decision = {frame->index, domain->values[r]};
+
+			if (j == 0) {
+				solver->units[solver->num_units++] = decision;
+				continue;
+			}
+			if (!reserve_nogood(solver, j + 1)) {
+				return;
+			}
+
+			// The nogood is the assignments above the decision and the decision
+			size_t start = solver->num_literals;
+			for (size_t i = 0; i < j; i++) {
+				size_t variable = solver->frames[i].index;
+				solver->literals[start + i].variable = variable;
+				solver->literals[start + i].value = values[variable];
+			}
+			solver->literals[start + j] = decision;
+			solver->num_literals += j + 1;
+
+			// Watch the deepest literals, the last ones to be assigned again
+			size_t nogood = solver->num_nogoods++;
+			solver->nogood_starts[nogood] = start;
+			solver->nogood_starts[nogood + 1] = solver->num_literals;
+			watch(solver, 2 * nogood, start + j);
+			watch(solver, 2 * nogood + 1, start + j - 1);
+		}
+	}
+}
+
+bool csp_solver_apply_units(CSPSolver *solver){
+	bool result = true;
+
+	for (size_t i = 0; i < solver->num_units && result; i++) {
+		result = remove_value(solver, solver->units[i].variable,
+			solver->units[i].value
+		);
+	}
+	solver->num_units = 0;
+
+	return result;
+}
+
+bool csp_solver_propagate_nogoods(CSPSolver *solver, const size_t *values,
+	size_t index
+){
+	size_t *link = &solver->watch_heads[index];
+
+	while (*link != SIZE_MAX) {
+		size_t entry = *link;
+		size_t nogood = entry / 2;
+
+		// A nogood watching another value of the variable is not violated
+		if (solver->literals[solver->watches[entry]].value != values[index]) {
+			link = &solver->watch_next[entry];
+			continue;
+		}
+
+		// Watch another literal which is not satisfied
+		size_t replacement = SIZE_MAX;
+		for (size_t l = solver->nogood_starts[nogood];
+			l < solver->nogood_starts[nogood + 1]; l++
+		) {
+			if (l != solver->watches[entry] && l != solver->watches[entry ^ 1]
+				&& !literal_is_satisfied(solver, values, &solver->literals[l])
+			) {
+				replacement = l;
+				break;
+			}
+		}
+		if (replacement != SIZE_MAX) {
+			*link = solver->watch_next[entry];
+			watch(solver, entry, replacement);
+			continue;
+		}
+		link = &solver->watch_next[entry];
+
+		// Otherwise, the other watched literal is the last one not satisfied
+		const CSPSolverLiteral *last = &solver->literals[
+			solver->watches[entry ^ 1]
+		];
+		if (filled_variables_is_filled(solver->fv, last->variable)) {
+			if (values[last->variable] == last->value) {
+				return false;
+			}
+		} else if (!remove_value(solver, last->variable, last->value)) {
+			return false;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,156 @@
+/**
+ * @file csp-solver-ovals.c
+ * Library CSP value heuristics
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#include "solver/csp-solver-ovals.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "core/csp-constraint.h"
+#include "core/csp-lib.h"
+#include "core/csp-problem.h"
+#include "solver/types-and-structs.h"
+#include "util/stats.h"
+
+// PRIVATE
+// Add the number of values of the domain of y removed by each value of x
+static void score_conflicts(const CSPConstraint *constraint, size_t *values,
+	const void *data, size_t x, size_t y, Domain **domains, size_t *scores
+){
+	CSPChecker *check = csp_constraint_get_check(constraint);
+	const Domain *domain_x = domains[x];
+	const Domain *domain_y = domains[y];
+
+	for (size_t i = 0; i < domain_x->amount; i++) {
+		values[x] = domain_x->values[i];
+		for (size_t j = 0; j < domain_y->amount; j++) {
+			values[y] = domain_y->values[j];
+			STATS(stats_counters.checks++);
+			if (!check(constraint, values, data)) {
+				scores[values[x]]++;
+			}
+		}
+	}
+}
+
+// Get the other variable of a binary constraint, SIZE_MAX if it is not one
+static size_t constraint_other(const CSPConstraint *constraint, size_t index){
+	if (csp_constraint_get_arity(constraint) != 2) {
+		return SIZE_MAX;
+	}
+
+	size_t var0 = csp_constraint_get_variable(constraint, 0);
+	size_t var1 = csp_constraint_get_variable(constraint, 1);
+	if (var0 == index && var1 != index) {
+		return var1;
+	} else if (var1 == index && var0 != index) {
+		return var0;
+	}
+	return SIZE_MAX;
+}
+
+// PUBLIC
+void csp_problem_order_least_constraining(const CSPProblem *csp,
+	size_t *values, const void *data, size_t index, FilledVariables *fv,
+	CSPValueChecklist *checklist, CSPConstraint **checks, Domain **domains,
+	size_t *scores
+){
+	assert(csp_initialised());
+	assert(checklist == NULL || checks != NULL);
+
+	Domain *domain = domains[index];
+	for (size_t i = 0; i < domain->amount; i++) {
+		scores[domain->values[i]] = 0;
+	}
+
+	if (checklist == NULL) {
+		size_t amount;
+		CSPConstraint *const *constraints = csp_problem_get_variable_constraints(
+			csp, index, &amount
+		);
+
+		for (size_t k = 0; k < amount; k++) {
+			size_t other = constraint_other(constraints[k], index);
+			if (other != SIZE_MAX && !filled_variables_is_filled(fv, other)) {
+				score_conflicts(constraints[k], values, data, index, other, domains,
+					scores
+				);
+			}
+		}
+	} else {
+		// The checklist gives the constraints of a variable with the filled ones
+		for (size_t i = 0; i < fv->size; i++) {
+			if (filled_variables_is_filled(fv, i)) {
+				continue;
+			}
+
+			size_t amount = 0;
+			checklist(csp, checks, &amount, i, fv);
+			for (size_t k = 0; k < amount; k++) {
+				if (constraint_other(checks[k], i) == index) {
+					score_conflicts(checks[k], values, data, index, i, domains,
+						scores
+					);
+					break;
+				}
+			}
+		}
+	}
+
+	domain_sort(domain, scores);
+}
+
+void csp_problem_count_supports(const CSPProblem *csp, size_t *values,
+	const void *data, size_t index, Domain **domains, size_t *supports
+){
+	assert(csp_initialised());
+	assert(csp_problem_is_finalised(csp));
+
+	const Domain *domain = domains[index];
+	size_t amount;
+	CSPConstraint *const *constraints = csp_problem_get_variable_constraints(csp,
+		index, &amount
+	);
+
+	for (size_t i = 0; i < domain->amount; i++) {
+		supports[domain->values[i]] = 0;
+	}
+	for (size_t k = 0; k < amount; k++) {
+		size_t other = constraint_other(constraints[k], index);
+		if (other == SIZE_MAX) {
+			continue;
+		}
+
+		const Domain *domain_other = domains[other];
+		CSPChecker *check = csp_constraint_get_check(constraints[k]);
+		for (size_t i = 0; i < domain->amount; i++) {
+			values[index] = domain->values[i];
+			for (size_t j = 0; j < domain_other->amount; j++) {
+				values[other] = domain_other->values[j];
+				STATS(stats_counters.checks++);
+				if (check(constraints[k], values, data)) {
+					supports[values[index]]++;
+				}
+			}
+		}
+	}
+}
+
+void csp_problem_order_most_supported(Domain *domain, const size_t *supports,
+	size_t *scores
+){
+	assert(csp_initialised());
+
+	for (size_t i = 0; i < domain->amount; i++) {
+		scores[domain->values[i]] = SIZE_MAX - supports[domain->values[i]];
+	}
+	domain_sort(domain, scores);
+}
@@ -0,0 +1,79 @@
+/**
+ * @file csp-solver-ovals.h
+ * Library CSP value heuristics
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#pragma once
+
+#if !defined (_CSP_H_INSIDE) && !defined (CSP_COMPILATION)
+#error "Only <csp/csp.h> can be included directly."
+#endif
+
+#include <stddef.h>
+
+#include "core/csp-problem.h"
+#include "solver/types-and-structs.h"
+
+/**
+ * Order the values left of a variable of the CSP problem.
+ * This function puts first the values removing the fewest values from the
+ * domains of the unfilled variables linked to it by a binary constraint
+ * (Least Constraining Value heuristic).
+ *
+ * @param csp The CSP problem instance.
+ * @param values The values of the variables.
+ * @param data The data to pass to the check function.
+ * @param index The index of the variable, marked as filled.
+ * @param fv The structure tracking filled variables.
+ * @param checklist A pointer to function to get the list of necessary
+ * constraints for a variable, or NULL to use the constraints index of the
+ * finalised CSP problem.
+ * @param checks The buffer receiving the constraints of the checklist, unused
+ * if checklist is NULL.
+ * @param domains The array of domains for each variable.
+ * @param scores A buffer indexed by value, of at least the size of the domain
+ * of the variable.
+ * @pre The csp library is initialised.
+ */
+extern void csp_problem_order_least_constraining(const CSPProblem *csp,
+	size_t *values, const void *data, size_t index, FilledVariables *fv,
+	CSPValueChecklist *checklist, CSPConstraint **checks, Domain **domains,
+	size_t *scores
+);
+
+/**
+ * Count the supports of the values left of a variable of the CSP problem,
+ * the values left in the domains of the other variables of its binary
+ * constraints which satisfy them.
+ *
+ * @param csp The finalised CSP problem instance.
+ * @param values The values of the variables.
+ * @param data The data to pass to the check function.
+ * @param index The index of the variable.
+ * @param domains The array of domains for each variable.
+ * @param supports The number of supports of each value, indexed by value.
+ * @pre The csp library is initialised.
+ * @pre The CSP problem is finalised.
+ */
+extern void csp_problem_count_supports(const CSPProblem *csp, size_t *values,
+	const void *data, size_t index, Domain **domains, size_t *supports
+);
+
+/**
+ * Order the values left of a variable of the CSP problem.
+ * This function puts first the values with the most supports counted by
+ * #csp_problem_count_supports, a cheap approximation of the Least
+ * Constraining Value heuristic.
+ *
+ * @param domain The domain of the variable.
+ * @param supports The number of supports of each value, indexed by value.
+ * @param scores A buffer indexed by value, of at least the size of the domain.
+ * @pre The csp library is initialised.
+ */
+extern void csp_problem_order_most_supported(Domain *domain,
+	const size_t *supports, size_t *scores
+);
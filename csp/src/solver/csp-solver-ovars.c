@@ -10,19 +10,45 @@
 #include "solver/csp-solver-ovars.h"
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
+#include "core/csp-constraint.h"
 #include "core/csp-problem.h"
 #include "core/csp-lib.h"
 #include "solver/types-and-structs.h"
+#include "util/random.h"
 
+// PRIVATE
+// Verify if a constraint involves an unfilled variable other than index
+static bool constraint_is_open(const CSPConstraint *constraint, size_t index,
+	const FilledVariables *fv
+){
+	for (size_t k = 0; k < csp_constraint_get_arity(constraint); k++) {
+		size_t variable = csp_constraint_get_variable(constraint, k);
+		if (variable != index && !filled_variables_is_filled(fv, variable)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// Verify if a variable tied with the best one replaces it, each of the ties
+// being chosen with the same probability
+static bool tie_wins(uint64_t *random, size_t *ties){
+	return random != NULL && random_below(random, ++*ties) == 0;
+}
+
+// PUBLIC
 size_t csp_problem_choose_min_domain(const CSPProblem *csp,
-	const FilledVariables *fv, Domain **domains
+	const FilledVariables *fv, Domain **domains, uint64_t *random
 ){
 	assert(csp_initialised());
 
 	size_t index = 0;
 	size_t min_domain_size = SIZE_MAX;
+	size_t ties = 1;
 
 	for (size_t i = 0; i < csp_problem_get_num_domains(csp); i++) {
 		if (!filled_variables_is_filled(fv, i)) {
@@ -30,9 +56,12 @@ size_t csp_problem_choose_min_domain(const CSPProblem *csp,
 			if (domain_size < min_domain_size) {
 				min_domain_size = domain_size;
 				index = i;
-				if (min_domain_size == 1) {	 // exit early
+				ties = 1;
+				if (min_domain_size == 1 && random == NULL) {	 // exit early
 					break;
 				}
+			} else if (domain_size == min_domain_size && tie_wins(random, &ties)) {
+				index = i;
 			}
 		}
 	}
@@ -41,11 +70,12 @@ size_t csp_problem_choose_min_domain(const CSPProblem *csp,
 }
 
 size_t csp_problem_choose_max_domain(const CSPProblem *csp,
-	const FilledVariables *fv, Domain **domains){
+	const FilledVariables *fv, Domain **domains, uint64_t *random){
 	assert(csp_initialised());
 
 	size_t index = 0;
 	size_t max_domain_size = 0;
+	size_t ties = 1;
 
 	for (size_t i = 0; i < csp_problem_get_num_domains(csp); i++) {
 		if (!filled_variables_is_filled(fv, i)) {
@@ -53,12 +83,66 @@ size_t csp_problem_choose_max_domain(const CSPProblem *csp,
 			if (domain_size > max_domain_size) {
 				max_domain_size = domain_size;
 				index = i;
+				ties = 1;
 				// if (max_domain_size == ?) {	 // is there an exit early?
 				// 	break;
 				// }
+			} else if (domain_size == max_domain_size && tie_wins(random, &ties)) {
+				index = i;
 			}
 		}
 	}
 
 	return index;
-}
\ No newline at end of file
+}
+
+size_t csp_problem_choose_dom_wdeg(const CSPProblem *csp,
+	const FilledVariables *fv, Domain **domains, const size_t *weights,
+	uint64_t *random){
+	assert(csp_initialised());
+	assert(csp_problem_is_finalised(csp));
+
+	size_t index = SIZE_MAX;
+	size_t best_domain_size = 0;
+	size_t best_wdeg = 0;
+	size_t ties = 1;
+
+	for (size_t i = 0; i < csp_problem_get_num_domains(csp); i++) {
+		if (filled_variables_is_filled(fv, i)) {
+			continue;
+		}
+
+		size_t amount;
+		CSPConstraint *const *constraints = csp_problem_get_variable_constraints(
+			csp, i, &amount
+		);
+		const size_t *ids = csp_problem_get_variable_constraint_ids(csp, i,
+			&amount
+		);
+
+		size_t wdeg = 0;
+		for (size_t k = 0; k < amount; k++) {
+			if (constraint_is_open(constraints[k], i, fv)) {
+				wdeg += weights[ids[k]];
+			}
+		}
+
+		// Compare the ratios without dividing, a variable without weight having
+		// an infinite one
+		size_t domain_size = domains[i]->amount;
+		if (index == SIZE_MAX
+			|| domain_size * best_wdeg < best_domain_size * wdeg
+		) {
+			index = i;
+			best_domain_size = domain_size;
+			best_wdeg = wdeg;
+			ties = 1;
+		} else if (domain_size * best_wdeg == best_domain_size * wdeg
+			&& tie_wins(random, &ties)
+		) {
+			index = i;
+		}
+	}
+
+	return index != SIZE_MAX ? index : 0;
+}
@@ -14,6 +14,7 @@
 #endif
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include "core/csp-problem.h"
 #include "solver/types-and-structs.h"
@@ -26,10 +27,12 @@
  * @param csp The CSP problem instance.
  * @param fv The structure tracking filled variables.
  * @param domains The array of domains for each variable.
+ * @param random The state of the generator breaking ties at random, NULL to
+ * choose the first variable of the ties.
  * @return The index of the chosen variable.
  */
 extern size_t csp_problem_choose_min_domain(const CSPProblem *csp,
-	const FilledVariables *fv, Domain **domains);
+	const FilledVariables *fv, Domain **domains, uint64_t *random);
 
 /**
  * Choose the next variable to assign in the CSP problem.
@@ -39,7 +42,27 @@ extern size_t csp_problem_choose_min_domain(const CSPProblem *csp,
  * @param csp
  * @param fv
  * @param domains
+ * @param random
  * @return
  */
 extern size_t csp_problem_choose_max_domain(const CSPProblem *csp,
-	const FilledVariables *fv, Domain **domains);
\ No newline at end of file
+	const FilledVariables *fv, Domain **domains, uint64_t *random);
+/**
+ * Choose the next variable to assign in the CSP problem.
+ * This function selects the variable with the smallest ratio of its domain
+ * size to the sum of the weights of its constraints involving another unfilled
+ * variable (dom/wdeg heuristic).
+ *
+ * @param csp The finalised CSP problem instance.
+ * @param fv The structure tracking filled variables.
+ * @param domains The array of domains for each variable.
+ * @param weights The weight of each constraint of the CSP problem, the number
+ * of domain wipeouts it caused plus one.
+ * @param random The state of the generator breaking ties at random, NULL to
+ * choose the first variable of the ties.
+ * @return The index of the chosen variable.
+ * @pre The CSP problem is finalised.
+ */
+extern size_t csp_problem_choose_dom_wdeg(const CSPProblem *csp,
+	const FilledVariables *fv, Domain **domains, const size_t *weights,
+	uint64_t *random);
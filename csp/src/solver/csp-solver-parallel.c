@@ -0,0 +1,378 @@
+/**
+ * @file csp-solver-parallel.c
+ * Library CSP parallel search sharing subtrees between threads
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#include "solver/csp-solver-parallel.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/csp-lib.h"
+#include "core/csp-problem.h"
+#include "solver/csp-solver.h"
+#include "solver/csp-solver-enumerate.h"
+#include "solver/types-and-structs.h"
+
+#include "solver/csp-solver.inc.h"
+
+/**
+ * @brief The work shared by the threads of a parallel search.
+ * @var mutex The lock of the pool.
+ * @var cond The condition signalled when a path is added or the search stops.
+ * @var num_domains The number of variables of the CSP problem.
+ * @var num_threads The number of threads.
+ * @var paths The paths of the subtrees left to search, num_domains literals
+ * each.
+ * @var lengths The number of decisions of each path.
+ * @var num_paths The number of paths.
+ * @var idle The number of threads waiting for a path.
+ * @var hungry The number of waiting threads no path is left for.
+ * @var stop The flag stopping the threads once the search is over.
+ * @var solved Whether a solution was found.
+ * @var solution The values of the first solution found, NULL if the threads
+ * enumerate the solutions.
+ * @var enumerating Whether the threads go on searching after each solution.
+ * @var callback The callback receiving the solutions of an enumeration, NULL
+ * to only count them.
+ * @var callback_arg The argument to pass to the callback.
+ * @var solutions The number of solutions of an enumeration.
+ */
+struct _CSPSolverPool {
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	size_t num_domains;
+	size_t num_threads;
+	CSPSolverLiteral *paths;
+	size_t *lengths;
+	size_t num_paths;
+	size_t idle;
+	atomic_size_t hungry;
+	atomic_bool stop;
+	bool solved;
+	size_t *solution;
+	bool enumerating;
+	CSPSolutionCallback *callback;
+	void *callback_arg;
+	uint64_t solutions;
+};
+
+/**
+ * @brief A thread of a parallel search.
+ * @var pool The work shared by the threads.
+ * @var solver The solver of the thread.
+ * @var values The values of the variables of the thread.
+ * @var path The path of the subtree being searched.
+ * @var data The data to pass to the check function.
+ * @var solve_type The type of solving to use.
+ * @var discarded The solutions of the thread found once the callback of
+ * another one stopped the enumeration.
+ */
+typedef struct {
+	CSPSolverPool *pool;
+	CSPSolver *solver;
+	size_t *values;
+	CSPSolverLiteral *path;
+	const void *data;
+	SolveType solve_type;
+	uint64_t discarded;
+} CSPSolverWorker;
+
+// PRIVATE
+// Count the waiting threads no path is left for, the pool being locked
+static void csp_solver_pool_update(CSPSolverPool *pool){
+	atomic_store_explicit(&pool->hungry,
+		pool->idle > pool->num_paths ? pool->idle - pool->num_paths : 0,
+		memory_order_relaxed
+	);
+}
+
+// Give a solution of an enumeration to the callback, one thread at a time
+static bool csp_solver_pool_found(const size_t *values, void *arg){
+	CSPSolverWorker *worker = arg;
+	CSPSolverPool *pool = worker->pool;
+
+	pthread_mutex_lock(&pool->mutex);
+	bool next = !atomic_load(&pool->stop);
+	if (!next) {
+		worker->discarded++;
+	} else if (!pool->callback(values, pool->callback_arg)) {
+		next = false;
+		atomic_store(&pool->stop, true);
+		pthread_cond_broadcast(&pool->cond);
+	}
+	pthread_mutex_unlock(&pool->mutex);
+
+	return next;
+}
+
+static void *csp_solver_pool_run(void *arg){
+	CSPSolverWorker *worker = arg;
+	CSPSolverPool *pool = worker->pool;
+
+	bool root = csp_solver_prepare(worker->solver, worker->values,
+		worker->data, worker->solve_type, NULL
+	);
+
+	pthread_mutex_lock(&pool->mutex);
+	while (!atomic_load(&pool->stop)) {
+		if (pool->num_paths > 0) {
+			// Take the last path given
+			size_t length = pool->lengths[--pool->num_paths];
+			memcpy(worker->path, &pool->paths[pool->num_paths * pool->num_domains],
+				length * sizeof(CSPSolverLiteral)
+			);
+			csp_solver_pool_update(pool);
+			pthread_mutex_unlock(&pool->mutex);
+
+			bool result = root && csp_solver_search(worker->solver,
+				worker->values, worker->data, worker->solve_type, NULL,
+				worker->path, length
+			);
+
+			// An enumeration only stops once its callback asked to
+			pthread_mutex_lock(&pool->mutex);
+			if (result && !pool->enumerating && !pool->solved) {
+				pool->solved = true;
+				memcpy(pool->solution, worker->values,
+					pool->num_domains * sizeof(size_t)
+				);
+				atomic_store(&pool->stop, true);
+				pthread_cond_broadcast(&pool->cond);
+			}
+			continue;
+		}
+
+		// The search is over once every thread waits for a path
+		pool->idle++;
+		if (pool->idle == pool->num_threads) {
+			atomic_store(&pool->stop, true);
+			pthread_cond_broadcast(&pool->cond);
+			break;
+		}
+		csp_solver_pool_update(pool);
+		pthread_cond_wait(&pool->cond, &pool->mutex);
+		pool->idle--;
+		csp_solver_pool_update(pool);
+	}
+	pthread_mutex_unlock(&pool->mutex);
+
+	return NULL;
+}
+
+static void csp_solver_pool_discard(CSPSolverWorker *workers,
+	size_t num_workers
+){
+	for (size_t i = 0; i < num_workers; i++) {
+		if (workers[i].solver != NULL) {
+			csp_solver_destroy(workers[i].solver);
+		}
+		free(workers[i].values);
+		free(workers[i].path);
+	}
+	free(workers);
+}
+
+// Search with the threads of the pool, false if an error occurred
+static bool csp_solver_pool_solve(CSPSolverPool *pool, const CSPProblem *csp,
+	const void *data, SolveType solve_type, CSPSolveStats *stats
+){
+	size_t num_threads = pool->num_threads;
+	size_t literals = pool->num_domains > 0 ? pool->num_domains : 1;
+	atomic_init(&pool->hungry, 0);
+	atomic_init(&pool->stop, false);
+
+	// Fewer threads than the pool wait for a path at once
+	pool->paths = malloc(num_threads * literals * sizeof(CSPSolverLiteral));
+	pool->lengths = malloc(num_threads * sizeof(size_t));
+	if (pool->paths == NULL || pool->lengths == NULL) {
+		perror("malloc");
+		free(pool->paths);
+		free(pool->lengths);
+		return false;
+	}
+
+	// The first thread to take a path starts from the root
+	pool->lengths[0] = 0;
+	pool->num_paths = 1;
+
+	CSPSolverWorker *workers = calloc(num_threads, sizeof(CSPSolverWorker));
+	if (workers == NULL) {
+		perror("calloc");
+		free(pool->paths);
+		free(pool->lengths);
+		return false;
+	}
+	for (size_t i = 0; i < num_threads; i++) {
+		workers[i].pool = pool;
+		workers[i].data = data;
+		workers[i].solve_type = solve_type;
+		workers[i].solver = csp_solver_create(csp);
+		workers[i].values = malloc(literals * sizeof(size_t));
+		workers[i].path = malloc(literals * sizeof(CSPSolverLiteral));
+		if (workers[i].solver == NULL || workers[i].values == NULL
+			|| workers[i].path == NULL
+		) {
+			if (workers[i].values == NULL || workers[i].path == NULL) {
+				perror("malloc");
+			}
+			csp_solver_pool_discard(workers, i + 1);
+			free(pool->paths);
+			free(pool->lengths);
+			return false;
+		}
+
+		workers[i].solver->stop = &pool->stop;
+		workers[i].solver->pool = pool;
+		workers[i].solver->hungry = &pool->hungry;
+		if (pool->enumerating) {
+			workers[i].solver->enumerating = true;
+			if (pool->callback != NULL) {
+				workers[i].solver->callback = csp_solver_pool_found;
+				workers[i].solver->callback_arg = &workers[i];
+			}
+		}
+	}
+
+	pthread_mutex_init(&pool->mutex, NULL);
+	pthread_cond_init(&pool->cond, NULL);
+
+	// Start the threads, stopping the ones already started on failure
+	pthread_t *threads = malloc(num_threads * sizeof(pthread_t));
+	size_t started = 0;
+	bool error = threads == NULL;
+	if (error) {
+		perror("malloc");
+	}
+	for (; !error && started < num_threads; started++) {
+		int code = pthread_create(&threads[started], NULL, csp_solver_pool_run,
+			&workers[started]
+		);
+		if (code != 0) {
+			errno = code;
+			perror("pthread_create");
+			pthread_mutex_lock(&pool->mutex);
+			atomic_store(&pool->stop, true);
+			pthread_cond_broadcast(&pool->cond);
+			pthread_mutex_unlock(&pool->mutex);
+			error = true;
+			break;
+		}
+	}
+	for (size_t i = 0; i < started; i++) {
+		pthread_join(threads[i], NULL);
+	}
+	free(threads);
+
+	// The solutions of each thread are summed, but the ones no longer given
+	pool->solutions = 0;
+	for (size_t i = 0; i < num_threads; i++) {
+		pool->solutions += workers[i].solver->solutions - workers[i].discarded;
+	}
+	if (stats != NULL) {
+		*stats = (CSPSolveStats) {0};
+		for (size_t i = 0; i < num_threads; i++) {
+			csp_solver_merge_stats(stats, &workers[i].solver->stats, true);
+		}
+	}
+
+	pthread_cond_destroy(&pool->cond);
+	pthread_mutex_destroy(&pool->mutex);
+	csp_solver_pool_discard(workers, num_threads);
+	free(pool->paths);
+	free(pool->lengths);
+
+	return !error;
+}
+
+// PUBLIC
+// Functions
+void csp_solver_share(CSPSolver *solver, const size_t *values){
+	CSPSolverPool *pool = solver->pool;
+
+	// Only lock the pool if a decision has a value left to give
+	size_t depth = 0;
+	while (depth < solver->depth
+		&& solver->frames[depth].position >= solver->frames[depth].end
+	) {
+		depth++;
+	}
+	if (depth == solver->depth) {
+		return;
+	}
+
+	pthread_mutex_lock(&pool->mutex);
+	while (pool->num_paths < pool->idle) {
+		size_t length = csp_solver_split(solver, values,
+			&pool->paths[pool->num_paths * pool->num_domains]
+		);
+		if (length == 0) {
+			break;
+		}
+		pool->lengths[pool->num_paths++] = length;
+		pthread_cond_signal(&pool->cond);
+	}
+	csp_solver_pool_update(pool);
+	pthread_mutex_unlock(&pool->mutex);
+}
+
+bool csp_problem_solve_parallel(const CSPProblem *csp, size_t *values,
+	const void *data, SolveType solve_type, size_t num_threads,
+	CSPSolveStats *stats
+){
+	assert(csp_initialised());
+	assert(csp_problem_is_finalised(csp));
+	assert(num_threads > 0);
+
+	CSPSolverPool pool = {
+		.num_domains = csp_problem_get_num_domains(csp),
+		.num_threads = num_threads,
+		.solution = values
+	};
+
+	return csp_solver_pool_solve(&pool, csp, data, solve_type, stats)
+		&& pool.solved;
+}
+
+uint64_t csp_problem_enumerate_parallel(const CSPProblem *csp,
+	const void *data, SolveType solve_type, size_t num_threads,
+	CSPSolutionCallback *callback, void *arg, CSPSolveStats *stats
+){
+	assert(csp_initialised());
+	assert(csp_problem_is_finalised(csp));
+	assert(num_threads > 0);
+
+	CSPSolverPool pool = {
+		.num_domains = csp_problem_get_num_domains(csp),
+		.num_threads = num_threads,
+		.enumerating = true,
+		.callback = callback,
+		.callback_arg = arg
+	};
+
+	if (!csp_solver_pool_solve(&pool, csp, data, solve_type, stats)) {
+		return 0;
+	}
+	return pool.solutions;
+}
+
+uint64_t csp_problem_count_solutions_parallel(const CSPProblem *csp,
+	const void *data, SolveType solve_type, size_t num_threads,
+	CSPSolveStats *stats
+){
+	return csp_problem_enumerate_parallel(csp, data, solve_type, num_threads,
+		NULL, NULL, stats
+	);
+}
@@ -0,0 +1,101 @@
+/**
+ * @file csp-solver-parallel.h
+ * Library CSP parallel search sharing subtrees between threads
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#pragma once
+
+#if !defined (_CSP_H_INSIDE) && !defined (CSP_COMPILATION)
+#error "Only <csp/csp.h> can be included directly."
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "core/csp-problem.h"
+#include "solver/csp-solver.h"
+#include "solver/csp-solver-enumerate.h"
+#include "solver/types-and-structs.h"
+
+/**
+ * Solve the CSP problem with several threads searching disjoint subtrees of
+ * the same search tree. Each thread owns its domains, filled variables and
+ * change stack. A thread running out of work waits until another one gives
+ * it the last value left of its shallowest decision, as the path of decisions
+ * leading to that subtree.
+ * @param csp The CSP problem to solve, shared by every thread.
+ * @param values The values of the variables.
+ * @param data The data to pass to the check function, shared by every thread.
+ * @param solve_type The type of solving to use (FC, MAC, CBJ, OVARS, OVALS).
+ * @param num_threads The number of threads.
+ * @param stats The statistics of the solve, summed over the threads except
+ * for the peaks and the times which are the largest ones, NULL if not
+ * required.
+ * @return true if the CSP problem is solved, false otherwise.
+ * @pre The csp library is initialised.
+ * @pre The CSP problem is finalised.
+ * @pre num_threads > 0.
+ * @post The values are assigned to the first solution found.
+ * @note The check functions of the constraints are called concurrently and
+ * must not modify the data.
+ */
+extern bool csp_problem_solve_parallel(const CSPProblem *csp, size_t *values,
+	const void *data, SolveType solve_type, size_t num_threads,
+	CSPSolveStats *stats
+);
+
+/**
+ * Enumerate the solutions of the CSP problem with several threads searching
+ * disjoint subtrees of the same search tree, each thread going on after each
+ * of its solutions until every subtree was searched.
+ * @param csp The CSP problem to solve, shared by every thread.
+ * @param data The data to pass to the check function, shared by every thread.
+ * @param solve_type The type of solving to use (FC, MAC, CBJ, OVARS, OVALS).
+ * @param num_threads The number of threads.
+ * @param callback The callback receiving each solution, NULL to only count
+ * them. It is called by one thread at a time.
+ * @param arg The argument to pass to the callback.
+ * @param stats The statistics of the enumeration, summed over the threads
+ * except for the peaks and the times which are the largest ones, NULL if not
+ * required.
+ * @return The number of solutions found, summed over the threads, every one
+ * unless the callback stopped the enumeration, 0 if an error occurred.
+ * @pre The csp library is initialised.
+ * @pre The CSP problem is finalised.
+ * @pre num_threads > 0.
+ * @note The solutions are found in no particular order. Once the callback
+ * stopped the enumeration, the solutions the other threads find are neither
+ * given nor counted.
+ * @note Without a dynamic variable ordering nor backjumping, the nodes,
+ * decisions and backtracks are the ones of a sequential enumeration, a value
+ * given to another thread being counted by the thread searching its subtree.
+ */
+extern uint64_t csp_problem_enumerate_parallel(const CSPProblem *csp,
+	const void *data, SolveType solve_type, size_t num_threads,
+	CSPSolutionCallback *callback, void *arg, CSPSolveStats *stats
+);
+
+/**
+ * Count the solutions of the CSP problem with several threads searching
+ * disjoint subtrees of the same search tree.
+ * @param csp The CSP problem to solve, shared by every thread.
+ * @param data The data to pass to the check function, shared by every thread.
+ * @param solve_type The type of solving to use (FC, MAC, CBJ, OVARS, OVALS).
+ * @param num_threads The number of threads.
+ * @param stats The statistics of the count, summed over the threads except
+ * for the peaks and the times which are the largest ones, NULL if not
+ * required.
+ * @return The number of solutions, 0 if an error occurred.
+ * @pre The csp library is initialised.
+ * @pre The CSP problem is finalised.
+ * @pre num_threads > 0.
+ */
+extern uint64_t csp_problem_count_solutions_parallel(const CSPProblem *csp,
+	const void *data, SolveType solve_type, size_t num_threads,
+	CSPSolveStats *stats
+);
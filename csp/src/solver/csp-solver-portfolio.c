@@ -0,0 +1,190 @@
+/**
+ * @file csp-solver-portfolio.c
+ * Library CSP portfolio of solvers racing on threads
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#include "solver/csp-solver-portfolio.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/csp-lib.h"
+#include "core/csp-problem.h"
+#include "solver/csp-solver.h"
+#include "solver/types-and-structs.h"
+
+#include "solver/csp-solver.inc.h"
+
+/**
+ * @brief The state shared by the threads of a portfolio.
+ * @var data The data to pass to the check function.
+ * @var stop The flag stopping the solvers once a configuration won.
+ * @var winner The index of the winning configuration, SIZE_MAX until one
+ * finishes.
+ */
+typedef struct {
+	const void *data;
+	atomic_bool stop;
+	atomic_size_t winner;
+} CSPPortfolioRace;
+
+/**
+ * @brief A thread of a portfolio.
+ * @var race The state shared by the threads.
+ * @var config The configuration of the solver.
+ * @var index The index of the configuration.
+ * @var solver The solver of the thread.
+ * @var values The values of the variables of the thread.
+ * @var result Whether the solver solved the CSP problem.
+ * @var stats The statistics of the solve.
+ */
+typedef struct {
+	CSPPortfolioRace *race;
+	const CSPPortfolioConfig *config;
+	size_t index;
+	CSPSolver *solver;
+	size_t *values;
+	bool result;
+	CSPSolveStats stats;
+} CSPPortfolioWorker;
+
+// PRIVATE
+static void *csp_portfolio_run(void *arg){
+	CSPPortfolioWorker *worker = arg;
+	CSPPortfolioRace *race = worker->race;
+
+	worker->result = csp_solver_solve(worker->solver, worker->values,
+		race->data, worker->config->solve_type, NULL, NULL, &worker->stats
+	);
+
+	// A stopped solver never finishes first, the flag being set by the winner
+	size_t expected = SIZE_MAX;
+	if (atomic_compare_exchange_strong(&race->winner, &expected,
+		worker->index
+	)) {
+		atomic_store(&race->stop, true);
+	}
+
+	return NULL;
+}
+
+static void csp_portfolio_discard(CSPPortfolioWorker *workers,
+	size_t num_workers
+){
+	for (size_t i = 0; i < num_workers; i++) {
+		if (workers[i].solver != NULL) {
+			csp_solver_destroy(workers[i].solver);
+		}
+		free(workers[i].values);
+	}
+	free(workers);
+}
+
+// PUBLIC
+// Functions
+bool csp_problem_solve_portfolio(const CSPProblem *csp, size_t *values,
+	const void *data, const CSPPortfolioConfig *configs, size_t num_configs,
+	size_t *winner, CSPSolveStats *stats
+){
+	assert(csp_initialised());
+	assert(csp_problem_is_finalised(csp));
+	assert(num_configs > 0);
+
+	size_t num_domains = csp_problem_get_num_domains(csp);
+	CSPPortfolioRace race = {.data = data};
+	atomic_init(&race.stop, false);
+	atomic_init(&race.winner, SIZE_MAX);
+
+	if (winner != NULL) {
+		*winner = SIZE_MAX;
+	}
+
+	// Allocate every solver before the race so that none starts late
+	CSPPortfolioWorker *workers = calloc(num_configs,
+		sizeof(CSPPortfolioWorker)
+	);
+	if (workers == NULL) {
+		perror("calloc");
+		return false;
+	}
+	for (size_t i = 0; i < num_configs; i++) {
+		workers[i].race = &race;
+		workers[i].config = &configs[i];
+		workers[i].index = i;
+		workers[i].solver = csp_solver_create(csp);
+		workers[i].values = malloc(
+			(num_domains > 0 ? num_domains : 1) * sizeof(size_t)
+		);
+		if (workers[i].solver == NULL || workers[i].values == NULL) {
+			if (workers[i].values == NULL) {
+				perror("malloc");
+			}
+			csp_portfolio_discard(workers, i + 1);
+			return false;
+		}
+
+		workers[i].solver->stop = &race.stop;
+		csp_solver_set_restarts(workers[i].solver, configs[i].restart_type,
+			configs[i].restart_base, configs[i].restart_factor
+		);
+		csp_solver_set_seed(workers[i].solver, configs[i].seed);
+	}
+
+	// Start the race, stopping the threads already started on failure
+	pthread_t *threads = malloc(num_configs * sizeof(pthread_t));
+	if (threads == NULL) {
+		perror("malloc");
+		csp_portfolio_discard(workers, num_configs);
+		return false;
+	}
+	size_t started = 0;
+	bool error = false;
+	for (; started < num_configs; started++) {
+		int code = pthread_create(&threads[started], NULL, csp_portfolio_run,
+			&workers[started]
+		);
+		if (code != 0) {
+			errno = code;
+			perror("pthread_create");
+			atomic_store(&race.stop, true);
+			error = true;
+			break;
+		}
+	}
+	for (size_t i = 0; i < started; i++) {
+		pthread_join(threads[i], NULL);
+	}
+	free(threads);
+
+	// The threads stopped by an error cannot tell whether a solution exists
+	size_t first = atomic_load(&race.winner);
+	bool result = false;
+	if (first != SIZE_MAX && !(error && !workers[first].result)) {
+		result = workers[first].result;
+		if (result) {
+			memcpy(values, workers[first].values, num_domains * sizeof(size_t));
+		}
+		if (winner != NULL) {
+			*winner = first;
+		}
+		if (stats != NULL) {
+			*stats = workers[first].stats;
+		}
+	}
+
+	csp_portfolio_discard(workers, num_configs);
+
+	return result;
+}
@@ -0,0 +1,65 @@
+/**
+ * @file csp-solver-portfolio.h
+ * Library CSP portfolio of solvers racing on threads
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#pragma once
+
+#if !defined (_CSP_H_INSIDE) && !defined (CSP_COMPILATION)
+#error "Only <csp/csp.h> can be included directly."
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "core/csp-problem.h"
+#include "solver/csp-solver.h"
+#include "solver/types-and-structs.h"
+
+/**
+ * @brief A configuration of a solver of a portfolio.
+ * @var solve_type The type of solving to use.
+ * @var restart_type The restart strategy.
+ * @var restart_base The number of failures before the first restart.
+ * @var restart_factor The growth of the budget of RESTARTS_GEOMETRIC.
+ * @var seed The seed breaking the ties of the variable heuristics, 0 to break
+ * them by index.
+ */
+typedef struct {
+	SolveType solve_type;
+	RestartType restart_type;
+	size_t restart_base;
+	double restart_factor;
+	uint64_t seed;
+} CSPPortfolioConfig;
+
+/**
+ * Solve the CSP problem with several configurations racing on as many
+ * threads. The first configuration to solve the problem or to prove it has no
+ * solution wins, the others being stopped before their next decision.
+ * @param csp The CSP problem to solve, shared by every thread.
+ * @param values The values of the variables.
+ * @param data The data to pass to the check function, shared by every thread.
+ * @param configs The configurations of the solvers.
+ * @param num_configs The number of configurations.
+ * @param winner The index of the winning configuration, SIZE_MAX if an error
+ * occurred, or NULL.
+ * @param stats The statistics of the winning configuration, NULL if not
+ * required.
+ * @return true if the CSP problem is solved, false otherwise.
+ * @pre The csp library is initialised.
+ * @pre The CSP problem is finalised.
+ * @pre num_configs > 0.
+ * @post The values are assigned to the solution of the winning configuration.
+ * @note The check functions of the constraints are called concurrently and
+ * must not modify the data.
+ */
+extern bool csp_problem_solve_portfolio(const CSPProblem *csp, size_t *values,
+	const void *data, const CSPPortfolioConfig *configs, size_t num_configs,
+	size_t *winner, CSPSolveStats *stats
+);
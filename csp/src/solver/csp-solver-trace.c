@@ -0,0 +1,230 @@
+/**
+ * @file csp-solver-trace.c
+ * Library CSP tracing of the events of a search
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#include "solver/csp-solver-trace.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "core/csp-lib.h"
+#include "solver/csp-solver.h"
+#include "util/clock.h"
+
+#include "solver/csp-solver.inc.h"
+
+/**
+ * @brief A ring buffer keeping the last events of a search.
+ * @var capacity The number of events kept.
+ * @var start The index of the oldest event.
+ * @var count The number of events kept.
+ * @var dropped The number of events dropped.
+ * @var events The events, circular.
+ */
+struct _CSPTraceBuffer {
+	size_t capacity;
+	size_t start;
+	size_t count;
+	size_t dropped;
+	CSPTraceEvent events[];
+};
+
+// PRIVATE
+// Write an event as a Chrome trace event, ts being in microseconds
+static void csp_trace_write_event(FILE *file, bool *first,
+	const char *phase, const char *name, size_t variable, double ts,
+	const char *args
+){
+	fprintf(file, "%s\n{\"name\":\"", *first ? "" : ",");
+	if (variable != SIZE_MAX) {
+		fprintf(file, "%s%zu", name, variable);
+	} else {
+		fputs(name, file);
+	}
+	fprintf(file, "\",\"cat\":\"search\",\"ph\":\"%s\",\"ts\":%.3f,"
+		"\"pid\":0,\"tid\":0%s}", phase, ts, args
+	);
+	*first = false;
+}
+
+// PUBLIC
+// Getters
+size_t csp_trace_buffer_get_count(const CSPTraceBuffer *buffer){
+	return buffer->count;
+}
+size_t csp_trace_buffer_get_dropped(const CSPTraceBuffer *buffer){
+	return buffer->dropped;
+}
+const CSPTraceEvent *csp_trace_buffer_get_event(const CSPTraceBuffer *buffer,
+	size_t index
+){
+	assert(index < buffer->count);
+
+	return &buffer->events[(buffer->start + index) % buffer->capacity];
+}
+
+// Constructors
+CSPTraceBuffer *csp_trace_buffer_create(size_t capacity){
+	assert(capacity > 0);
+
+	CSPTraceBuffer *buffer = malloc(
+		sizeof(CSPTraceBuffer) + capacity * sizeof(CSPTraceEvent)
+	);
+	if (buffer == NULL) {
+		perror("malloc");
+		return NULL;
+	}
+
+	buffer->capacity = capacity;
+	csp_trace_buffer_clear(buffer);
+	return buffer;
+}
+
+// Destructors
+void csp_trace_buffer_destroy(CSPTraceBuffer *buffer){
+	free(buffer);
+}
+
+// Setters
+void csp_solver_set_trace(CSPSolver *solver, CSPTraceHook *hook, void *arg){
+	assert(csp_initialised());
+
+	solver->trace = hook;
+	solver->trace_arg = arg;
+}
+
+void csp_trace_buffer_clear(CSPTraceBuffer *buffer){
+	buffer->start = 0;
+	buffer->count = 0;
+	buffer->dropped = 0;
+}
+
+// Functions
+void csp_solver_trace(const CSPSolver *solver, TraceEventType type,
+	size_t depth, size_t variable, size_t value
+){
+	CSPTraceEvent event = {
+		.type = type,
+		.depth = depth,
+		.variable = variable,
+		.value = value,
+		.time = clock_now()
+	};
+	solver->trace(&event, solver->trace_arg);
+}
+
+void csp_solver_trace_prunes(const CSPSolver *solver, size_t start){
+	for (size_t i = start; i < solver->stack_top; i++) {
+		size_t variable = solver->change_stack[i].domain_index;
+		csp_solver_trace(solver, TRACE_PRUNE, solver->depth, variable,
+			solver->domains[variable]->amount
+		);
+	}
+}
+
+void csp_trace_buffer_record(const CSPTraceEvent *event, void *buffer){
+	CSPTraceBuffer *ring = buffer;
+
+	if (ring->count < ring->capacity) {
+		ring->events[(ring->start + ring->count++) % ring->capacity] = *event;
+	} else {
+		ring->events[ring->start] = *event;
+		ring->start = (ring->start + 1) % ring->capacity;
+		ring->dropped++;
+	}
+}
+
+bool csp_trace_buffer_write_chrome(const CSPTraceBuffer *buffer,
+	const char *path
+){
+	FILE *file = fopen(path, "w");
+	if (file == NULL) {
+		perror("fopen");
+		return false;
+	}
+
+	double origin = buffer->count > 0
+		? csp_trace_buffer_get_event(buffer, 0)->time : 0.0;
+	double ts = 0.0;
+	size_t depth = 0;
+	bool first = true;
+	char args[64];
+
+	// The oldest events may have been dropped, so only the slices opened in
+	// the buffer are closed
+	size_t open = 0;
+
+	fputs("{\"traceEvents\":[", file);
+	for (size_t i = 0; i < buffer->count; i++) {
+		const CSPTraceEvent *event = csp_trace_buffer_get_event(buffer, i);
+		ts = (event->time - origin) * 1e6;
+
+		switch (event->type) {
+			case TRACE_ASSIGN:
+				snprintf(args, sizeof(args), ",\"args\":{\"value\":%zu}",
+					event->value
+				);
+				csp_trace_write_event(file, &first, "B", "x", event->variable, ts,
+					args
+				);
+				open++;
+				depth = event->depth;
+				break;
+			case TRACE_UNASSIGN:
+				if (open == 0) {
+					continue;
+				}
+				csp_trace_write_event(file, &first, "E", "x", event->variable, ts,
+					""
+				);
+				open--;
+				depth = event->depth - 1;
+				break;
+			case TRACE_PRUNE:
+				snprintf(args, sizeof(args), ",\"s\":\"t\",\"args\":{\"left\":%zu}",
+					event->value
+				);
+				csp_trace_write_event(file, &first, "i", "prune x",
+					event->variable, ts, args
+				);
+				continue;
+			case TRACE_WIPEOUT:
+				csp_trace_write_event(file, &first, "i",
+					event->variable != SIZE_MAX ? "wipeout x" : "wipeout",
+					event->variable, ts, ",\"s\":\"t\""
+				);
+				continue;
+			case TRACE_SOLUTION:
+				csp_trace_write_event(file, &first, "i", "solution", SIZE_MAX, ts,
+					",\"s\":\"g\""
+				);
+				continue;
+		}
+
+		// The depth is a counter following the decisions
+		snprintf(args, sizeof(args), ",\"args\":{\"depth\":%zu}", depth);
+		csp_trace_write_event(file, &first, "C", "depth", SIZE_MAX, ts, args);
+	}
+	for (; open > 0; open--) {
+		csp_trace_write_event(file, &first, "E", "x", SIZE_MAX, ts, "");
+	}
+	fputs("\n],\"displayTimeUnit\":\"ns\"}\n", file);
+
+	bool result = !ferror(file);
+	if (fclose(file) != 0) {
+		perror("fclose");
+		result = false;
+	} else if (!result) {
+		perror("fprintf");
+	}
+	return result;
+}
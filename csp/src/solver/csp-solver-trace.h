@@ -0,0 +1,136 @@
+/**
+ * @file csp-solver-trace.h
+ * Library CSP tracing of the events of a search
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#pragma once
+
+#if !defined (_CSP_H_INSIDE) && !defined (CSP_COMPILATION)
+#error "Only <csp/csp.h> can be included directly."
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "solver/csp-solver.h"
+
+typedef enum {
+	TRACE_ASSIGN = 0,
+	TRACE_UNASSIGN = 1,
+	TRACE_PRUNE = 2,
+	TRACE_WIPEOUT = 3,
+	TRACE_SOLUTION = 4,
+} TraceEventType;
+
+/**
+ * @brief An event of a search.
+ * @var type The type of the event.
+ * @var depth The number of decisions of the search, the decision of the event
+ * being the deepest one.
+ * @var variable The variable assigned, unassigned or pruned, the other
+ * variable of the constraint which wiped its domain out, or SIZE_MAX if there
+ * is none.
+ * @var value The value assigned or unassigned, the number of values left in
+ * the domain of the variable pruned, or SIZE_MAX if there is none.
+ * @var time The time of a monotonic clock, in seconds.
+ */
+typedef struct {
+	TraceEventType type;
+	size_t depth;
+	size_t variable;
+	size_t value;
+	double time;
+} CSPTraceEvent;
+
+/**
+ * Receive an event of a search.
+ * @param event The event, only valid during the call.
+ * @param arg The argument given with the hook.
+ */
+typedef void CSPTraceHook(const CSPTraceEvent *event, void *arg);
+
+/**
+ * @brief A ring buffer keeping the last events of a search.
+ */
+typedef struct _CSPTraceBuffer CSPTraceBuffer;
+
+// Getters
+/**
+ * Get the number of events kept by the ring buffer.
+ * @param buffer The ring buffer.
+ * @return The number of events.
+ */
+extern size_t csp_trace_buffer_get_count(const CSPTraceBuffer *buffer);
+/**
+ * Get the number of events the ring buffer dropped to keep the last ones.
+ * @param buffer The ring buffer.
+ * @return The number of events dropped.
+ */
+extern size_t csp_trace_buffer_get_dropped(const CSPTraceBuffer *buffer);
+/**
+ * Get an event kept by the ring buffer.
+ * @param buffer The ring buffer.
+ * @param index The index of the event, from the oldest one.
+ * @return The event.
+ * @pre index < csp_trace_buffer_get_count(buffer).
+ */
+extern const CSPTraceEvent *csp_trace_buffer_get_event(
+	const CSPTraceBuffer *buffer, size_t index
+);
+
+// Constructors
+/**
+ * Create a ring buffer keeping the last events of a search.
+ * @param capacity The number of events kept.
+ * @return The ring buffer, NULL if an error occurred.
+ * @pre capacity > 0.
+ */
+extern CSPTraceBuffer *csp_trace_buffer_create(size_t capacity);
+
+// Destructors
+/**
+ * Destroy a ring buffer.
+ * @param buffer The ring buffer.
+ */
+extern void csp_trace_buffer_destroy(CSPTraceBuffer *buffer);
+
+// Setters
+/**
+ * Set the hook receiving the events of the searches of a solver.
+ * @param solver The solver.
+ * @param hook The hook, NULL to stop tracing.
+ * @param arg The argument to pass to the hook.
+ * @note Without a hook, tracing costs a single branch per event.
+ */
+extern void csp_solver_set_trace(CSPSolver *solver, CSPTraceHook *hook,
+	void *arg
+);
+/**
+ * Forget the events of a ring buffer.
+ * @param buffer The ring buffer.
+ */
+extern void csp_trace_buffer_clear(CSPTraceBuffer *buffer);
+
+// Functions
+/**
+ * Record an event in a ring buffer, dropping the oldest one if it is full.
+ * It is a #CSPTraceHook to set with the ring buffer as argument.
+ * @param event The event.
+ * @param buffer The ring buffer.
+ */
+extern void csp_trace_buffer_record(const CSPTraceEvent *event, void *buffer);
+/**
+ * Write the events of a ring buffer to a file in the Chrome trace event
+ * format, readable by chrome://tracing and Perfetto. The assignments are
+ * nested slices, the depth a counter, and the other events instants.
+ * @param buffer The ring buffer.
+ * @param path The path of the file.
+ * @return true if the file was written, false otherwise.
+ */
+extern bool csp_trace_buffer_write_chrome(const CSPTraceBuffer *buffer,
+	const char *path
+);
@@ -11,67 +11,712 @@
 #include "solver/csp-solver.h"
 
 #include <assert.h>
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "core/csp-constraint.h"
+#include "core/csp-lib.h"
 #include "core/csp-problem.h"
 #include "solver/csp-solver-fc.h"
+#include "solver/csp-solver-mac.h"
+#include "solver/csp-solver-ovals.h"
 #include "solver/csp-solver-ovars.h"
 #include "solver/types-and-structs.h"
+#include "util/bits.h"
+#include "util/clock.h"
+#include "util/stats.h"
 
-int backtrack_counter = 0;
+#include "solver/csp-solver.inc.h"
 
-void reduce_domains(const CSPProblem *csp, size_t *values, const void *data,
-	Domain **domains, CSPDataChecklist dataChecklist
+// Maximum number of words of the conflict sets a solver allocates
+#define MAX_CONFLICT_WORDS ((size_t) 1 << 24)
+
+// Number of decisions between two readings of the clock of the time limit
+#define CLOCK_PERIOD 64
+
+#ifdef CSP_STATS
+_Thread_local StatsCounters stats_counters;
+#endif
+
+// PRIVATE
+// Verify if every variable of the constraint is filled
+static bool constraint_is_filled(const CSPConstraint *constraint,
+	const FilledVariables *fv
 ){
-	if (dataChecklist == NULL) {
-		return;
+	for (size_t k = 0; k < csp_constraint_get_arity(constraint); k++) {
+		if (!filled_variables_is_filled(fv,
+			csp_constraint_get_variable(constraint, k)
+		)) {
+			return false;
+		}
 	}
-	for (size_t i = 0; i < csp_problem_get_num_domains(csp); i++) {
-		for (size_t j = 0; j < domains[i]->amount; /* no increment here */) {
+	return true;
+}
 
-			CSPConstraint *checks[csp_problem_get_num_constraints(csp)];
-			size_t amount = 0;
+// Index the arcs of the finalised CSP problem bound to the solver, keeping the
+// buffers of the previous one when they are large enough
+static bool csp_solver_index_arcs(CSPSolver *solver){
+	const CSPProblem *csp = solver->csp;
 
-			dataChecklist(csp, checks, &amount, i);
+	csp_solver_free_tables(solver);
+	solver->num_arcs = 0;
+	solver->residues_indexed = false;
+	solver->num_residues = 0;
+	solver->nary = false;
+
+	if (!csp_problem_is_finalised(csp)) {
+		return true;
+	}
+
+	// Every CSP problem bound to the solver has the same number of variables
+	if (solver->arc_bases == NULL) {
+		solver->arc_bases = malloc((solver->num_domains + 1) * sizeof(size_t));
+		if (solver->arc_bases == NULL) {
+			return false;
+		}
+	}
+	solver->arc_bases[0] = 0;
+	for (size_t i = 0; i < solver->num_domains; i++) {
+		size_t amount;
+		csp_problem_get_variable_constraints(csp, i, &amount);
+		solver->arc_bases[i + 1] = solver->arc_bases[i] + amount;
+	}
+	solver->num_arcs = solver->arc_bases[solver->num_domains];
+
+	if (solver->arc_mirrors == NULL || solver->num_arcs > solver->arc_capacity) {
+		free(solver->arc_mirrors);
+		free(solver->residue_offsets);
+		solver->residue_offsets = NULL;
+		solver->arc_capacity = solver->num_arcs > 0 ? solver->num_arcs : 1;
+		solver->arc_mirrors = malloc(solver->arc_capacity * sizeof(size_t));
+		if (solver->arc_mirrors == NULL) {
+			solver->arc_capacity = 0;
+			return false;
+		}
+	}
+
+	// The constraints of each variable are in the order of the CSP problem, so
+	// walking the constraints gives the arcs of each variable in order
+	size_t *cursors = solver->queue;
+	for (size_t i = 0; i < solver->num_domains; i++) {
+		cursors[i] = solver->arc_bases[i];
+	}
+	for (size_t i = 0; i < csp_problem_get_num_constraints(csp); i++) {
+		const CSPConstraint *constraint = csp_problem_get_constraint(csp, i);
+		size_t arity = csp_constraint_get_arity(constraint);
+		size_t first = SIZE_MAX;
+		if (arity > 2) {
+			solver->nary = true;
+		}
 
-			values[i] = domains[i]->values[j];
-			bool consistent = true;
-			for (size_t k = 0; k < amount; k++) {
-				if (!csp_constraint_get_check(checks[k])(
-					checks[k], values, data
-				)){
-					consistent = false;
+		for (size_t k = 0; k < arity; k++) {
+			size_t variable = csp_constraint_get_variable(constraint, k);
+
+			// A variable mentioned twice only has one arc
+			bool duplicate = false;
+			for (size_t l = 0; l < k; l++) {
+				if (csp_constraint_get_variable(constraint, l) == variable) {
+					duplicate = true;
 					break;
 				}
 			}
-			if (!consistent) {
-				// Remove the value from the domain
-				domains[i]->amount--;
-				for (size_t k = j; k < domains[i]->amount; k++) {
-					domains[i]->values[k] = domains[i]->values[k + 1];
+			if (duplicate) {
+				continue;
+			}
+
+			size_t arc = cursors[variable]++;
+			solver->arc_mirrors[arc] = SIZE_MAX;
+			if (arity == 2) {
+				if (first == SIZE_MAX) {
+					first = arc;
+				} else {
+					solver->arc_mirrors[first] = arc;
+					solver->arc_mirrors[arc] = first;
 				}
-				// Do not increment j, as the next value is now at the same
-				// index
+			}
+		}
+	}
+
+	return csp_solver_index_tables(solver);
+}
+
+// Choose the next variable to assign
+static size_t csp_solver_choose(CSPSolver *solver, SolveType solve_type){
+	uint64_t *random = solver->seed != 0 ? &solver->random : NULL;
+
+	if (solver->bucketed) {
+		return csp_solver_choose_bucket(solver, !(solve_type & OVARS_MIN));
+	} else if (solve_type & OVARS_DOMWDEG) {
+		return csp_problem_choose_dom_wdeg(solver->csp, solver->fv,
+			solver->domains, solver->weights, random
+		);
+	} else if (solve_type & OVARS_MIN) {
+		return csp_problem_choose_min_domain(solver->csp, solver->fv,
+			solver->domains, random
+		);
+	} else if (solve_type & OVARS_MAX) {
+		return csp_problem_choose_max_domain(solver->csp, solver->fv,
+			solver->domains, random
+		);
+	} else {
+		return filled_variables_next_unfilled(solver->fv, 0);
+	}
+}
+
+// Increase the weight of a constraint of a variable which wiped a domain out
+static void csp_solver_bump_weight(CSPSolver *solver, size_t index,
+	const CSPConstraint *constraint
+){
+	size_t amount;
+	CSPConstraint *const *constraints = csp_problem_get_variable_constraints(
+		solver->csp, index, &amount
+	);
+	const size_t *ids = csp_problem_get_variable_constraint_ids(solver->csp,
+		index, &amount
+	);
+
+	for (size_t k = 0; k < amount; k++) {
+		if (constraints[k] == constraint) {
+			solver->weights[ids[k]]++;
+			return;
+		}
+	}
+}
+
+// Allocate the conflict sets of the solver if they fit
+static void csp_solver_prepare_conflicts(CSPSolver *solver){
+	if (solver->conflicts != NULL || solver->num_domains == 0) {
+		return;
+	}
+
+	size_t words = (solver->num_domains + 63) / 64;
+	if (words > MAX_CONFLICT_WORDS / solver->num_domains) {
+		return;
+	}
+	solver->conflicts = malloc(solver->num_domains * words * sizeof(uint64_t));
+	if (solver->conflicts == NULL) {
+		perror("malloc");
+		return;
+	}
+	solver->conflict_words = words;
+}
+
+// Get the conflict set of a depth
+static uint64_t *csp_solver_conflict(const CSPSolver *solver, size_t depth){
+	return &solver->conflicts[depth * solver->conflict_words];
+}
+
+// Add the depths lower than limit to a conflict set
+static void csp_solver_add_all_culprits(size_t limit, uint64_t *conflict){
+	for (size_t word = 0; word < limit / 64; word++) {
+		conflict[word] = UINT64_MAX;
+	}
+	if (limit % 64 != 0) {
+		conflict[limit / 64] |= (UINT64_C(1) << (limit % 64)) - 1;
+	}
+}
+
+// Add the depths lower than limit which removed values from the domain of a
+// variable to a conflict set
+static void csp_solver_add_culprits(const CSPSolver *solver, size_t variable,
+	size_t limit, uint64_t *conflict
+){
+	for (size_t depth = 0; depth < limit; depth++) {
+		const CSPSolverFrame *frame = &solver->frames[depth];
+		size_t end = depth + 1 < solver->depth
+			? solver->frames[depth + 1].stack_start : solver->stack_top;
+
+		for (size_t i = frame->stack_start; i < end; i++) {
+			if (solver->change_stack[i].domain_index != variable) {
+				continue;
+			}
+
+			// A nogood removes a value because of every decision above it
+			if (i >= frame->nogood_start) {
+				csp_solver_add_all_culprits(depth + 1, conflict);
 			} else {
-				j++;	// Increment only if no value was removed
+				conflict[depth / 64] |= UINT64_C(1) << (depth % 64);
 			}
 		}
 	}
 }
 
+// Get the variable whose domain a binary constraint of the current variable
+// wiped out, SIZE_MAX if it is unknown
+static size_t csp_solver_wiped(const CSPConstraint *wipeout, size_t index){
+	if (wipeout == NULL || csp_constraint_get_arity(wipeout) != 2) {
+		return SIZE_MAX;
+	}
+
+	size_t other = csp_constraint_get_variable(wipeout, 0);
+	return other != index ? other : csp_constraint_get_variable(wipeout, 1);
+}
+
+// Jump back to the deepest decision responsible for the failure of every value
+// of the current one, false if there is none
+static bool csp_solver_backjump(CSPSolver *solver){
+	size_t depth = solver->depth - 1;
+	size_t index = solver->frames[depth].index;
+	uint64_t *conflict = csp_solver_conflict(solver, depth);
+
+	// The values removed before the decision failed too
+	csp_solver_add_culprits(solver, index, depth, conflict);
+
+	size_t culprit = SIZE_MAX;
+	for (size_t word = solver->conflict_words; word-- > 0;) {
+		if (conflict[word] != 0) {
+			culprit = word * 64 + bits_highest(conflict[word]);
+			break;
+		}
+	}
+	if (culprit == SIZE_MAX) {
+		return false;
+	}
+
+	// The culprit inherits the other causes of the failure
+	uint64_t *target = csp_solver_conflict(solver, culprit);
+	for (size_t word = 0; word < solver->conflict_words; word++) {
+		target[word] |= conflict[word];
+	}
+	target[culprit / 64] &= ~(UINT64_C(1) << (culprit % 64));
+
+	while (solver->depth > culprit + 1) {
+		size_t index = solver->frames[--solver->depth].index;
+		filled_variables_mark_unfilled(solver->fv, index);
+		if (solver->bucketed) {
+			csp_solver_unfill_bucket(solver, index);
+		}
+	}
+	return true;
+}
+
+#ifdef CSP_STATS
+// Add the work done by the thread since a snapshot of its counters
+static void csp_solver_add_work(CSPSolver *solver, const StatsCounters *since,
+	double start, double *time
+){
+	solver->stats.checks += stats_counters.checks - since->checks;
+	solver->stats.pruned += stats_counters.pruned - since->pruned;
+	*time += clock_now() - start;
+}
+#endif
+
+// Open a decision on the next variable to assign
+static void csp_solver_push(CSPSolver *solver, size_t *values,
+	const void *data, SolveType solve_type, CSPValueChecklist *checklist
+){
+	CSPSolverFrame *frame = &solver->frames[solver->depth++];
+	STATS(if (solver->depth > solver->stats.max_depth) {
+		solver->stats.max_depth = solver->depth;
+	});
+
+	frame->index = csp_solver_choose(solver, solve_type);
+	frame->position = 0;
+	frame->end = solver->domains[frame->index]->amount;
+	frame->stack_start = solver->stack_top;
+	frame->table_start = solver->table_top;
+
+	filled_variables_mark_filled(solver->fv, frame->index);
+	if (solver->bucketed) {
+		csp_solver_fill_bucket(solver, frame->index);
+	}
+
+	if ((solve_type & CBJ) && solver->conflicts != NULL) {
+		memset(csp_solver_conflict(solver, solver->depth - 1), 0,
+			solver->conflict_words * sizeof(uint64_t)
+		);
+	}
+
+	// The values of a filled variable are not filtered, they keep this order
+	// until it is unfilled
+	if (solve_type & OVALS) {
+		csp_problem_order_least_constraining(solver->csp, values, data,
+			frame->index, solver->fv, checklist, solver->checks, solver->domains,
+			solver->scores
+		);
+	} else if (solve_type & OVALS_SUPPORTS) {
+		csp_problem_order_most_supported(solver->domains[frame->index],
+			solver->supports[frame->index], solver->scores
+		);
+	}
+}
+
+// Get the i-th term of the Luby sequence, 1 1 2 1 1 2 4 1 1 2 ...
+static size_t luby(size_t i){
+	size_t size = 1;
+	size_t sequence = 0;
+
+	// Find the finite subsequence containing the term, and its position in it
+	while (size < i + 1) {
+		sequence++;
+		size = 2 * size + 1;
+	}
+	while (size - 1 != i) {
+		size = (size - 1) / 2;
+		sequence--;
+		i %= size;
+	}
+	return (size_t) 1 << sequence;
+}
+
+// Get the number of failures allowed before the next restart
+static size_t csp_solver_restart_budget(const CSPSolver *solver){
+	switch (solver->restart_type) {
+		case RESTARTS_LUBY: {
+			size_t term = luby(solver->stats.restarts);
+			return solver->restart_base <= SIZE_MAX / term
+				? solver->restart_base * term : SIZE_MAX;
+		}
+		case RESTARTS_GEOMETRIC: {
+			double budget = (double) solver->restart_base;
+			for (size_t i = 0; i < solver->stats.restarts; i++) {
+				budget *= solver->restart_factor;
+				if (budget >= (double) (SIZE_MAX / 2)) {
+					return SIZE_MAX;
+				}
+			}
+			return (size_t) budget;
+		}
+		default:
+			return SIZE_MAX;
+	}
+}
+
+// Restart the search from the root, the refuted decisions being recorded
+static bool csp_solver_restart(CSPSolver *solver, size_t *values,
+	const void *data, SolveType solve_type
+){
+	csp_solver_record_nogoods(solver, values);
+
+	filled_variables_clear(solver->fv);
+	solver->depth = 0;
+	domain_change_stack_restore(solver->change_stack, &solver->stack_top,
+		&solver->root_top, solver->domains
+	);
+	csp_solver_restore_tables(solver, solver->root_table_top);
+
+	// The units only hold below the root, they are removed once for all
+	bool result = csp_solver_apply_units(solver);
+	if (result && (solve_type & MAC)) {
+		result = csp_solver_maintain_arc_consistency(solver, values, data,
+			SIZE_MAX
+		);
+	}
+	solver->root_top = solver->stack_top;
+	solver->root_table_top = solver->table_top;
+	solver->stats.restarts++;
+	if (solver->bucketed) {
+		csp_solver_build_buckets(solver);
+	}
+
+	return result;
+}
+
+// Propagate the assignment of the variable of the current decision
+static bool csp_solver_propagate(CSPSolver *solver, size_t *values,
+	const void *data, SolveType solve_type, CSPValueChecklist *checklist,
+	size_t index, CSPConstraint **wipeout
+){
+	const CSPProblem *csp = solver->csp;
+	bool result;
+
+	// Check if the assignment is consistent with the constraints
+	if (solve_type & MAC) {
+		result = csp_solver_maintain_arc_consistency(solver, values, data,
+			index
+		);
+	} else if (solve_type & FC) {
+		result = csp_problem_forward_check(csp, values, data, index, solver->fv,
+			checklist, solver->checks, solver->domains, solver->change_stack,
+			&solver->stack_top, wipeout
+		);
+		if (!result && csp_problem_is_finalised(csp)) {
+			csp_solver_bump_weight(solver, index, *wipeout);
+		}
+	} else {
+		result = csp_problem_is_consistent(csp, values, data, index, solver->fv,
+			checklist, solver->checks
+		);
+	}
+
+	STATS(if (!result && (solve_type & (MAC | FC))) {
+		solver->stats.wipeouts++;
+	});
+
+	// Check the nogoods forbidding the assignment
+	solver->frames[solver->depth - 1].nogood_start = solver->stack_top;
+	if (result && solver->num_nogoods > 0) {
+		result = csp_solver_propagate_nogoods(solver, values, index);
+	}
+
+	STATS(if (solver->stack_top > solver->stats.trail_peak) {
+		solver->stats.trail_peak = solver->stack_top;
+	});
+
+	return result;
+}
+
+// Count a solution of an enumeration, false if the callback asked to stop
+static bool csp_solver_found(CSPSolver *solver, const size_t *values,
+	const void *data, bool backjump
+){
+	solver->solutions++;
+
+	// The decisions of the branch did not fail for every value, so none can be
+	// jumped back over
+	if (backjump) {
+		for (size_t depth = 0; depth < solver->depth; depth++) {
+			csp_solver_add_all_culprits(depth,
+				csp_solver_conflict(solver, depth)
+			);
+		}
+	}
+
+	// Only the solutions improving the best one are kept while minimizing
+	if (solver->objective != NULL) {
+		double cost = solver->objective(values, data);
+		if (cost >= solver->best_cost) {
+			return true;
+		}
+		solver->best_cost = cost;
+		memcpy(solver->best, values, solver->num_domains * sizeof(size_t));
+	}
+
+	return solver->callback == NULL
+		|| solver->callback(values, solver->callback_arg);
+}
+
+// Verify if the search must stop before the next decision
+static bool csp_solver_interrupted(CSPSolver *solver){
+	// Another thread asked the search to stop
+	if (solver->stop != NULL
+		&& atomic_load_explicit(solver->stop, memory_order_relaxed)
+	) {
+		solver->interrupted = true;
+	} else if (solver->limited) {
+		const CSPSolveLimits *limits = &solver->limits;
+
+		if ((limits->nodes > 0 && solver->stats.nodes >= limits->nodes)
+			|| (limits->trail > 0 && solver->stack_top >= limits->trail)
+		) {
+			solver->interrupted = true;
+		} else if (limits->time > 0.0 && --solver->ticks == 0) {
+			solver->ticks = CLOCK_PERIOD;
+			solver->interrupted = clock_now() >= solver->deadline;
+		}
+	}
+	return solver->interrupted;
+}
+
+// Search below the current decisions, without going back over the first base
+// ones
+static bool csp_solver_backtrack(CSPSolver *solver, size_t *values,
+	const void *data, SolveType solve_type, CSPValueChecklist *checklist,
+	size_t base
+){
+	FilledVariables *fv = solver->fv;
+	Domain **domains = solver->domains;
+	size_t failures = 0;
+	size_t budget = csp_solver_restart_budget(solver);
+	bool backjump = (solve_type & CBJ) && solver->conflicts != NULL;
+
+	// The root node of the subtree
+	solver->stats.nodes++;
+	if (solver->depth == solver->num_domains) {
+		if (solver->trace != NULL) {
+			csp_solver_trace(solver, TRACE_SOLUTION, solver->depth, SIZE_MAX,
+				SIZE_MAX
+			);
+		}
+		return !solver->enumerating
+			|| !csp_solver_found(solver, values, data, false);
+	}
+	csp_solver_push(solver, values, data, solve_type, checklist);
+
+	while (solver->depth > base) {
+		// Another thread or a limit stopped the search
+		if (csp_solver_interrupted(solver)) {
+			return false;
+		}
+
+		// Other threads wait for a subtree to search
+		if (solver->hungry != NULL
+			&& atomic_load_explicit(solver->hungry, memory_order_relaxed) > 0
+		) {
+			csp_solver_share(solver, values);
+		}
+
+		CSPSolverFrame *frame = &solver->frames[solver->depth - 1];
+		size_t index = frame->index;
+
+		// Restore domains from the stack after the previous value
+		domain_change_stack_restore(solver->change_stack, &solver->stack_top,
+			&frame->stack_start, domains
+		);
+		csp_solver_restore_tables(solver, frame->table_start);
+		if (solver->bucketed) {
+			csp_solver_restore_buckets(solver);
+		}
+		if (solver->trace != NULL && frame->position > 0) {
+			csp_solver_trace(solver, TRACE_UNASSIGN, solver->depth, index,
+				values[index]
+			);
+		}
+
+		// All values were tried, backtrack to the previous decision
+		if (frame->position >= frame->end) {
+			STATS(solver->stats.backtracks++);
+			if (backjump) {
+				size_t depth = solver->depth;
+				if (!csp_solver_backjump(solver)) {
+					return false;
+				}
+
+				// The decisions jumped over are undone without being visited
+				if (solver->trace != NULL) {
+					while (--depth > solver->depth) {
+						size_t jumped = solver->frames[depth - 1].index;
+						csp_solver_trace(solver, TRACE_UNASSIGN, depth, jumped,
+							values[jumped]
+						);
+					}
+				}
+			} else {
+				filled_variables_mark_unfilled(fv, index);
+				if (solver->bucketed) {
+					csp_solver_unfill_bucket(solver, index);
+				}
+				solver->depth--;
+			}
+			continue;
+		}
+
+		// Assign the next value to the variable
+		values[index] = domains[index]->values[frame->position++];
+		STATS(solver->stats.decisions++);
+		if (solver->trace != NULL) {
+			csp_solver_trace(solver, TRACE_ASSIGN, solver->depth, index,
+				values[index]
+			);
+		}
+
+		// print_domains(domains, csp_problem_get_num_domains(csp)); //DEBUG
+
+		CSPConstraint *wipeout = NULL;
+		bool result = csp_solver_propagate(solver, values, data, solve_type,
+			checklist, index, &wipeout
+		);
+
+		// The subtree cannot improve the best solution of a minimization
+		if (result && solver->bound != NULL
+			&& solver->depth < solver->num_domains
+			&& solver->bound(values, fv, domains, data) >= solver->best_cost
+		) {
+			result = false;
+		}
+
+		if (solver->trace != NULL) {
+			csp_solver_trace_prunes(solver, frame->stack_start);
+			if (!result) {
+				csp_solver_trace(solver, TRACE_WIPEOUT, solver->depth,
+					csp_solver_wiped(wipeout, index), SIZE_MAX
+				);
+			}
+		}
+
+		// Only the wipeouts of forward checking by a binary constraint tell which
+		// decisions caused them, a value removed by a constraint of more variables
+		// being removed because of several decisions
+		if (!result && backjump) {
+			uint64_t *conflict = csp_solver_conflict(solver, solver->depth - 1);
+			size_t other = !solver->nary ? csp_solver_wiped(wipeout, index)
+				: SIZE_MAX;
+			if (other != SIZE_MAX) {
+				csp_solver_add_culprits(solver, other, solver->depth - 1, conflict);
+			} else {
+				csp_solver_add_all_culprits(solver->depth - 1, conflict);
+			}
+		}
+
+		if (result) {
+			solver->stats.nodes++;
+
+			// If all variables are assigned, the CSP is solved
+			if (solver->depth == solver->num_domains) {
+				if (solver->trace != NULL) {
+					csp_solver_trace(solver, TRACE_SOLUTION, solver->depth, SIZE_MAX,
+						SIZE_MAX
+					);
+				}
+
+				// An enumeration goes on with the next value
+				if (!solver->enumerating
+					|| !csp_solver_found(solver, values, data, backjump)
+				) {
+					return true;
+				}
+				continue;
+			}
+			csp_solver_push(solver, values, data, solve_type, checklist);
+		} else if (++failures >= budget) {
+			if (solver->trace != NULL) {
+				for (size_t depth = solver->depth; depth > 0; depth--) {
+					size_t undone = solver->frames[depth - 1].index;
+					csp_solver_trace(solver, TRACE_UNASSIGN, depth, undone,
+						values[undone]
+					);
+				}
+			}
+			if (!csp_solver_restart(solver, values, data, solve_type)) {
+				return false;
+			}
+			failures = 0;
+			budget = csp_solver_restart_budget(solver);
+			csp_solver_push(solver, values, data, solve_type, checklist);
+		}
+	}
+
+	return false;
+}
+
 // PUBLIC
 // Getters
 bool csp_problem_is_consistent(const CSPProblem *csp, const size_t *values,
 	const void *data, size_t index, FilledVariables *fv,
-	CSPValueChecklist *checklist
+	CSPValueChecklist *checklist, CSPConstraint **checks
 ){
 	assert(csp_initialised());
+	assert(checklist == NULL || checks != NULL);
+
+	if (checklist == NULL) {
+		size_t amount;
+		CSPConstraint *const *constraints = csp_problem_get_variable_constraints(
+			csp, index, &amount
+		);
+
+		// Only the constraints whose variables are all filled can be verified,
+		// the unary ones having already filtered the domains at the root
+		for (size_t i = 0; i < amount; i++) {
+			if (csp_constraint_get_arity(constraints[i]) == 1
+				|| !constraint_is_filled(constraints[i], fv)
+			) {
+				continue;
+			}
+			STATS(stats_counters.checks++);
+			if (!csp_constraint_get_check(constraints[i])(constraints[i], values,
+				data
+			)) {
+				return false;
+			}
+		}
+		return true;
+	}
 
-	CSPConstraint *checks[csp_problem_get_num_constraints(csp)];
 	size_t amount = 0;
 
 	// Get the list of checks to verify for the current index
@@ -79,6 +724,7 @@ bool csp_problem_is_consistent(const CSPProblem *csp, const size_t *values,
 
 	// if any check from the checklist fails, the CSP is not consistent
 	for (size_t i = 0; i < amount; i++) {
+		STATS(stats_counters.checks++);
 		if (!csp_constraint_get_check(checks[i])(checks[i], values, data)) {
 			return false;
 		}
@@ -86,140 +732,574 @@ bool csp_problem_is_consistent(const CSPProblem *csp, const size_t *values,
 	return true;
 }
 
-// Functions
-bool csp_problem_backtrack(const CSPProblem *csp, size_t *values,
-	const void *data, FilledVariables *fv, SolveType solve_type,
-	CSPValueChecklist *checklist, Domain **domains, DomainChange *change_stack,
-	size_t *stack_top
-){
+SolveOutcome csp_solver_get_outcome(const CSPSolver *solver){
 	assert(csp_initialised());
-	backtrack_counter++;
 
-	// If all variables are assigned, the CSP is solved
-	if (filled_variables_all_filled(fv)) {
-		return true;
+	return solver->outcome;
+}
+
+size_t csp_solver_get_restarts(const CSPSolver *solver){
+	assert(csp_initialised());
+
+	return solver->stats.restarts;
+}
+
+// Constructors
+CSPSolver *csp_solver_create(const CSPProblem *csp){
+	assert(csp_initialised());
+
+	CSPSolver *solver = calloc(1, sizeof(CSPSolver));
+	if (solver == NULL) {
+		perror("calloc");
+		return NULL;
 	}
 
-	size_t index;
-	size_t stack_start;
-	if (solve_type & FC) {
-		stack_start = *stack_top;
+	size_t num_domains = csp_problem_get_num_domains(csp);
+	size_t num_constraints = csp_problem_get_num_constraints(csp);
+	size_t stack_capacity = 0;
+	size_t max_capacity = 1;
+
+	solver->num_domains = num_domains;
+	solver->num_constraints = num_constraints;
+	solver->capacities = malloc(num_domains * sizeof(size_t));
+	solver->domains = calloc(num_domains, sizeof(Domain *));
+	solver->checks = malloc(num_constraints * sizeof(CSPConstraint *));
+	solver->frames = malloc(num_domains * sizeof(CSPSolverFrame));
+	solver->queue = malloc(num_domains * sizeof(size_t));
+	solver->queued = calloc(num_domains, sizeof(bool));
+	solver->supports = calloc(num_domains, sizeof(size_t *));
+	solver->weights = malloc(num_constraints * sizeof(size_t));
+	solver->watch_heads = malloc(num_domains * sizeof(size_t));
+	solver->best = malloc((num_domains > 0 ? num_domains : 1) * sizeof(size_t));
+	solver->bucket_order = malloc(num_domains * sizeof(size_t));
+	solver->bucket_positions = malloc(num_domains * sizeof(size_t));
+	solver->bucket_keys = malloc(num_domains * sizeof(size_t));
+	solver->fv = filled_variables_create(num_domains);
+	if (solver->capacities == NULL || solver->domains == NULL
+		|| solver->checks == NULL || solver->frames == NULL
+		|| solver->queue == NULL || solver->queued == NULL
+		|| solver->supports == NULL || solver->weights == NULL
+		|| solver->watch_heads == NULL || solver->best == NULL
+		|| solver->bucket_order == NULL || solver->bucket_positions == NULL
+		|| solver->bucket_keys == NULL || solver->fv == NULL
+	) {
+		csp_solver_destroy(solver);
+		return NULL;
 	}
 
-	if (solve_type & OVARS_MIN) {
-		index = csp_problem_choose_min_domain(csp, fv, domains);
-	} else if (solve_type & OVARS_MAX) {
-		index = csp_problem_choose_max_domain(csp, fv, domains);
+	// Allocate memory for each domain
+	for (size_t i = 0; i < num_domains; i++) {
+		solver->capacities[i] = csp_problem_get_domain(csp, i);
+		stack_capacity += solver->capacities[i];
+		if (solver->capacities[i] > max_capacity) {
+			max_capacity = solver->capacities[i];
+		}
+		solver->domains[i] = domain_create(solver->capacities[i]);
+		solver->supports[i] = malloc(
+			(solver->capacities[i] > 0 ? solver->capacities[i] : 1) * sizeof(size_t)
+		);
+		if (solver->domains[i] == NULL || solver->supports[i] == NULL) {
+			csp_solver_destroy(solver);
+			return NULL;
+		}
+	}
+
+	// The units are the values refuted at the root between two restarts
+	solver->scores = malloc(max_capacity * sizeof(size_t));
+	solver->units = malloc(max_capacity * sizeof(CSPSolverLiteral));
+	solver->num_buckets = max_capacity + 2;
+	solver->bucket_starts = malloc((solver->num_buckets + 1) * sizeof(size_t));
+	if (solver->scores == NULL || solver->units == NULL
+		|| solver->bucket_starts == NULL
+	) {
+		csp_solver_destroy(solver);
+		return NULL;
+	}
+
+	// Each change removes at least one value, and each value can be removed
+	// once from its domain along a branch
+	solver->change_stack = domain_change_stack_create(
+		stack_capacity > 0 ? stack_capacity : 1
+	);
+	if (solver->change_stack == NULL) {
+		csp_solver_destroy(solver);
+		return NULL;
+	}
+
+	solver->csp = csp;
+	if (!csp_solver_index_arcs(solver)) {
+		csp_solver_destroy(solver);
+		return NULL;
+	}
+	return solver;
+}
+
+// Destructors
+void csp_solver_destroy(CSPSolver *solver){
+	assert(csp_initialised());
+
+	if (solver->domains != NULL) {
+		for (size_t i = 0; i < solver->num_domains; i++) {
+			if (solver->domains[i] != NULL) {
+				domain_destroy(solver->domains[i]);
+			}
+		}
+	}
+	if (solver->supports != NULL) {
+		for (size_t i = 0; i < solver->num_domains; i++) {
+			free(solver->supports[i]);
+		}
+	}
+	if (solver->change_stack != NULL) {
+		domain_change_stack_destroy(solver->change_stack);
+	}
+	if (solver->fv != NULL) {
+		filled_variables_destroy(solver->fv);
+	}
+	free(solver->bucket_starts);
+	free(solver->bucket_keys);
+	free(solver->bucket_positions);
+	free(solver->bucket_order);
+	free(solver->residues);
+	free(solver->residue_offsets);
+	free(solver->arc_mirrors);
+	free(solver->arc_bases);
+	csp_solver_free_tables(solver);
+	free(solver->conflicts);
+	free(solver->units);
+	free(solver->watch_heads);
+	free(solver->assumptions);
+	free(solver->best);
+	free(solver->watch_next);
+	free(solver->watches);
+	free(solver->nogood_starts);
+	free(solver->literals);
+	free(solver->weights);
+	free(solver->supports);
+	free(solver->scores);
+	free(solver->queued);
+	free(solver->queue);
+	free(solver->frames);
+	free(solver->checks);
+	free(solver->domains);
+	free(solver->capacities);
+	free(solver);
+}
+
+// Setters
+bool csp_solver_reset(CSPSolver *solver, const CSPProblem *csp){
+	assert(csp_initialised());
+
+	if (csp_problem_get_num_domains(csp) != solver->num_domains
+		|| csp_problem_get_num_constraints(csp) > solver->num_constraints
+	) {
+		return false;
+	}
+	for (size_t i = 0; i < solver->num_domains; i++) {
+		if (csp_problem_get_domain(csp, i) > solver->capacities[i]) {
+			return false;
+		}
+	}
+
+	solver->csp = csp;
+	solver->root_ready = false;
+	return csp_solver_index_arcs(solver);
+}
+
+void csp_solver_set_restarts(CSPSolver *solver, RestartType restart_type,
+	size_t base, double factor
+){
+	assert(csp_initialised());
+	assert(restart_type == RESTARTS_NONE || base > 0);
+	assert(restart_type != RESTARTS_GEOMETRIC || factor >= 1.0);
+
+	solver->restart_type = restart_type;
+	solver->restart_base = base;
+	solver->restart_factor = factor;
+}
+
+void csp_solver_set_seed(CSPSolver *solver, uint64_t seed){
+	assert(csp_initialised());
+
+	solver->seed = seed;
+}
+
+void csp_solver_set_limits(CSPSolver *solver, const CSPSolveLimits *limits){
+	assert(csp_initialised());
+
+	if (limits != NULL) {
+		solver->limits = *limits;
 	} else {
-		index = filled_variables_next_unfilled(fv, 0);
+		solver->limits = (CSPSolveLimits) {0};
 	}
+	solver->limited = solver->limits.time > 0.0 || solver->limits.nodes > 0
+		|| solver->limits.trail > 0;
+}
 
-	filled_variables_mark_filled(fv, index);
+void csp_solver_set_cancel(CSPSolver *solver, const atomic_bool *cancel){
+	assert(csp_initialised());
 
-	// Try all values in the domain of the current variable
-	for (size_t i = 0; i < domains[index]->amount; i++) {
-		// Assign the value to the variable
-		values[index] = domains[index]->values[i];
+	solver->stop = cancel;
+}
 
-		// print_domains(domains, csp_problem_get_num_domains(csp)); //DEBUG
+// Functions
+void reduce_domains(const CSPProblem *csp, size_t *values, const void *data,
+	Domain **domains, CSPDataChecklist dataChecklist, CSPConstraint **checks
+){
+	assert(dataChecklist == NULL || checks != NULL);
 
-		bool result;
-		if (solve_type & FC) {
-			result = csp_problem_forward_check(csp, values, data, index, fv,
-					checklist, domains, change_stack, stack_top
-				) && csp_problem_backtrack(csp, values, data, fv, solve_type,
-					checklist, domains, change_stack, stack_top
-			);
+	if (dataChecklist == NULL && !csp_problem_is_finalised(csp)) {
+		return;
+	}
+	for (size_t i = 0; i < csp_problem_get_num_domains(csp); i++) {
+		size_t amount = 0;
+		CSPConstraint *const *constraints = checks;
+		if (dataChecklist != NULL) {
+			dataChecklist(csp, checks, &amount, i);
 		} else {
-			result = csp_problem_is_consistent(csp, values, data, index, fv,
-					checklist
-				) && csp_problem_backtrack(csp, values, data, fv, solve_type,
-					checklist, domains, NULL, NULL
+			constraints = csp_problem_get_variable_constraints(csp, i, &amount);
+		}
+
+		// Each constraint removes the values left it does not accept, without a
+		// checklist only unary constraints being data constraints
+		for (size_t k = 0; k < amount && domains[i]->amount > 0; k++) {
+			if (dataChecklist == NULL
+				&& csp_constraint_get_arity(constraints[k]) != 1
+			) {
+				continue;
+			}
+			domain_filter(domains[i], constraints[k], values, data, i);
+		}
+	}
+}
+
+bool csp_solver_prepare(CSPSolver *solver, size_t *values, const void *data,
+	SolveType solve_type, CSPDataChecklist dataChecklist
+){
+	const CSPProblem *csp = solver->csp;
+	bool mac = (solve_type & MAC) != 0;
+
+	// An incremental solver starts again from the root of its previous solve if
+	// it was reduced the same way
+	bool keep = solver->incremental && solver->root_ready
+		&& solver->root_mac == mac && solver->root_checklist == dataChecklist;
+
+	filled_variables_clear(solver->fv);
+	solver->depth = 0;
+	solver->stats = (CSPSolveStats) {0};
+	solver->solutions = 0;
+	solver->random = solver->seed;
+	solver->interrupted = false;
+	solver->ticks = CLOCK_PERIOD;
+	if (solver->limits.time > 0.0) {
+		solver->deadline = clock_now() + solver->limits.time;
+	}
+
+#ifdef CSP_STATS
+	StatsCounters counters = stats_counters;
+	double start = clock_now();
+#endif
+
+	bool result = true;
+	if (keep) {
+		domain_change_stack_restore(solver->change_stack, &solver->stack_top,
+			&solver->base_top, solver->domains
+		);
+		csp_solver_restore_tables(solver, solver->base_table_top);
+	} else {
+		// Start from the full domains
+		for (size_t i = 0; i < solver->num_domains; i++) {
+			domain_reset(solver->domains[i], csp_problem_get_domain(csp, i));
+		}
+		for (size_t i = 0; i < csp_problem_get_num_constraints(csp); i++) {
+			solver->weights[i] = 1;
+		}
+		solver->stack_top = 0;
+		solver->table_top = 0;
+		csp_solver_clear_nogoods(solver);
+		solver->nogoods_assumed = false;
+
+		reduce_domains(csp, values, data, solver->domains, dataChecklist,
+			solver->checks
+		);
+
+		// Make the domains arc consistent before the first decision
+		if (mac) {
+			csp_solver_prepare_residues(solver);
+			csp_solver_prepare_tables(solver);
+			result = csp_solver_maintain_arc_consistency(solver, values, data,
+				SIZE_MAX
 			);
 		}
-		// Check if the assignment is consistent with the constraints
-		if (result) {
-			return true;
+
+		solver->base_top = solver->stack_top;
+		solver->base_table_top = solver->table_top;
+		solver->root_ready = solver->incremental && result;
+		solver->root_mac = mac;
+		solver->root_checklist = dataChecklist;
+	}
+
+	// The assumptions are propagated like a decision at the root
+	if (result && solver->num_assumptions > 0) {
+		result = csp_solver_apply_assumptions(solver);
+		if (result && mac) {
+			result = csp_solver_maintain_arc_consistency(solver, values, data,
+				SIZE_MAX
+			);
 		}
-		if (solve_type & FC) {
-			// Restore domains from the stack after backtracking
-			domain_change_stack_restore(change_stack, stack_top, &stack_start,
-				domains
+	}
+	solver->root_top = solver->stack_top;
+	solver->root_table_top = solver->table_top;
+
+	if (solve_type & CBJ) {
+		csp_solver_prepare_conflicts(solver);
+	}
+
+	// Count the supports of the values once the domains are reduced
+	if (result && (solve_type & OVALS_SUPPORTS)) {
+		for (size_t i = 0; i < solver->num_domains; i++) {
+			csp_problem_count_supports(csp, values, data, i, solver->domains,
+				solver->supports[i]
 			);
 		}
 	}
-	filled_variables_mark_unfilled(fv, index);
-	return false;
+
+	STATS(csp_solver_add_work(solver, &counters, start,
+		&solver->stats.preprocess_time
+	));
+
+	return result;
 }
 
-bool csp_problem_solve(const CSPProblem *csp, size_t *values, const void *data,
+bool csp_solver_search(CSPSolver *solver, size_t *values, const void *data,
 	SolveType solve_type, CSPValueChecklist *checklist,
-	CSPDataChecklist dataChecklist, size_t *benchmark
+	const CSPSolverLiteral *path, size_t length
 ){
-	assert(csp_initialised());
+	assert(length == 0 || solver->restart_type == RESTARTS_NONE);
 
-	size_t num_domains = csp_problem_get_num_domains(csp);
-	FilledVariables *fv = filled_variables_create(num_domains);
-	if (fv == NULL) {
-		return false;
+#ifdef CSP_STATS
+	StatsCounters counters = stats_counters;
+	double start = clock_now();
+#endif
+
+	// Go back to the root of the search
+	filled_variables_clear(solver->fv);
+	domain_change_stack_restore(solver->change_stack, &solver->stack_top,
+		&solver->root_top, solver->domains
+	);
+	csp_solver_restore_tables(solver, solver->root_table_top);
+	solver->depth = 0;
+	solver->bucketed = false;
+
+	// Replay the decisions of the path, which have no other value to try, the
+	// thread which gave the value of the last one not having tried it
+	bool result = true;
+	if (length > 0) {
+		STATS(solver->stats.decisions++);
 	}
-	size_t stack_capacity = 0; // for FC
+	for (size_t i = 0; result && i < length; i++) {
+		CSPSolverFrame *frame = &solver->frames[solver->depth++];
+		size_t index = path[i].variable;
 
-	Domain *domains[num_domains];
-	// Allocate memory for each domain
-	for (size_t i = 0; i < num_domains; i++) {
-		size_t domain_size = csp_problem_get_domain(csp, i);
-		stack_capacity += domain_size; // for FC
-		domains[i] = domain_create(domain_size);
-		if (domains[i] == NULL) {
-			// Free previously allocated domains
-			for (size_t j = 0; j < i; j++) {
-				domain_destroy(domains[j]);
-			}
-			filled_variables_destroy(fv);
-			return false;
+		frame->index = index;
+		frame->position = 0;
+		frame->end = 0;
+		frame->stack_start = solver->stack_top;
+		frame->table_start = solver->table_top;
+		filled_variables_mark_filled(solver->fv, index);
+
+		if ((solve_type & CBJ) && solver->conflicts != NULL) {
+			memset(csp_solver_conflict(solver, solver->depth - 1), 0,
+				solver->conflict_words * sizeof(uint64_t)
+			);
 		}
+
+		CSPConstraint *wipeout = NULL;
+		values[index] = path[i].value;
+		result = domain_contains(solver->domains[index], path[i].value)
+			&& csp_solver_propagate(solver, values, data, solve_type, checklist,
+				index, &wipeout
+			);
 	}
 
-	reduce_domains(csp, values, data, domains, dataChecklist);
+	// The smallest or largest domain is read from the buckets instead of
+	// scanning the variables at each decision
+	if (result && (solve_type & (OVARS_MIN | OVARS_MAX))
+		&& !(solve_type & OVARS_DOMWDEG)
+	) {
+		csp_solver_build_buckets(solver);
+		solver->bucketed = true;
+	}
 
-	bool result;
-	if (solve_type & FC) {
-		// Initialize the change stack
-		DomainChange *change_stack = domain_change_stack_create(stack_capacity);
-		if (change_stack == NULL) {
-			for (size_t i = 0; i < num_domains; i++) {
-				domain_destroy(domains[i]);
-			}
-			filled_variables_destroy(fv);
-			return false;
+	if (result) {
+		result = csp_solver_backtrack(solver, values, data, solve_type,
+			checklist, length
+		);
+	}
+
+	STATS(csp_solver_add_work(solver, &counters, start,
+		&solver->stats.search_time
+	));
+
+	return result;
+}
+
+size_t csp_solver_split(CSPSolver *solver, const size_t *values,
+	CSPSolverLiteral *path
+){
+	for (size_t depth = 0; depth < solver->depth; depth++) {
+		CSPSolverFrame *frame = &solver->frames[depth];
+		if (frame->position >= frame->end) {
+			continue;
 		}
-		size_t stack_top = 0;
 
-		result = csp_problem_backtrack(csp, values, data, fv, solve_type,
-			checklist, domains, change_stack, &stack_top
-		);
+		// The decisions above lead to the subtree of the value
+		for (size_t i = 0; i < depth; i++) {
+			path[i].variable = solver->frames[i].index;
+			path[i].value = values[solver->frames[i].index];
+		}
+		path[depth].variable = frame->index;
+		path[depth].value = solver->domains[frame->index]->values[--frame->end];
 
-		domain_change_stack_destroy(change_stack);
+		// The failures of the values left do not tell about the given one
+		if (solver->conflicts != NULL) {
+			csp_solver_add_all_culprits(depth,
+				csp_solver_conflict(solver, depth)
+			);
+		}
+
+		return depth + 1;
+	}
+
+	return 0;
+}
+
+size_t csp_solver_last_unfilled(const CSPConstraint *constraint,
+	size_t excluded, const FilledVariables *fv
+){
+	size_t last = SIZE_MAX;
+	for (size_t k = 0; k < csp_constraint_get_arity(constraint); k++) {
+		size_t variable = csp_constraint_get_variable(constraint, k);
+		if (variable == excluded || variable == last
+			|| filled_variables_is_filled(fv, variable)
+		) {
+			continue;
+		}
+		if (last != SIZE_MAX) {
+			return SIZE_MAX;
+		}
+		last = variable;
+	}
+	return last;
+}
+
+void csp_solver_merge_stats(CSPSolveStats *total, const CSPSolveStats *stats,
+	bool concurrent
+){
+	total->nodes += stats->nodes;
+	total->restarts += stats->restarts;
+	total->decisions += stats->decisions;
+	total->backtracks += stats->backtracks;
+	total->checks += stats->checks;
+	total->pruned += stats->pruned;
+	total->wipeouts += stats->wipeouts;
+	if (stats->max_depth > total->max_depth) {
+		total->max_depth = stats->max_depth;
+	}
+	if (stats->trail_peak > total->trail_peak) {
+		total->trail_peak = stats->trail_peak;
+	}
+
+	// Concurrent searches spend their time at once
+	if (!concurrent) {
+		total->preprocess_time += stats->preprocess_time;
+		total->search_time += stats->search_time;
 	} else {
-		result = csp_problem_backtrack(csp, values, data, fv, solve_type,
-			checklist, domains, NULL, NULL
+		if (stats->preprocess_time > total->preprocess_time) {
+			total->preprocess_time = stats->preprocess_time;
+		}
+		if (stats->search_time > total->search_time) {
+			total->search_time = stats->search_time;
+		}
+	}
+}
+
+bool csp_solver_solve(CSPSolver *solver, size_t *values, const void *data,
+	SolveType solve_type, CSPValueChecklist *checklist,
+	CSPDataChecklist dataChecklist, CSPSolveStats *stats
+){
+	assert(csp_initialised());
+	assert(checklist != NULL || csp_problem_is_finalised(solver->csp));
+	assert(!(solve_type & MAC) || csp_problem_is_finalised(solver->csp));
+	assert(!(solve_type & OVALS_SUPPORTS)
+		|| csp_problem_is_finalised(solver->csp)
+	);
+	assert(!(solve_type & OVARS_DOMWDEG)
+		|| csp_problem_is_finalised(solver->csp)
+	);
+
+	// Start the backtracking algorithm
+	bool result = csp_solver_prepare(solver, values, data, solve_type,
+		dataChecklist
+	);
+	if (result) {
+		result = csp_solver_search(solver, values, data, solve_type, checklist,
+			NULL, 0
 		);
 	}
 
-	// Free allocated memory
-	for (size_t i = 0; i < num_domains; i++) {
-		domain_destroy(domains[i]);
+	if (result) {
+		solver->outcome = OUTCOME_SAT;
+	} else {
+		solver->outcome = solver->interrupted ? OUTCOME_UNKNOWN : OUTCOME_UNSAT;
 	}
+	if (stats != NULL) {
+		*stats = solver->stats;
+	}
+
+	return result;
+}
+
+bool csp_problem_solve(const CSPProblem *csp, size_t *values, const void *data,
+	SolveType solve_type, CSPValueChecklist *checklist,
+	CSPDataChecklist dataChecklist, CSPSolveStats *stats
+){
+	assert(csp_initialised());
 
-	if (benchmark != NULL) {
-		benchmark[0] = backtrack_counter;
+	CSPSolver *solver = csp_solver_create(csp);
+	if (solver == NULL) {
+		return false;
 	}
-	// Reset the backtrack counter
-	backtrack_counter = 0;
 
-	filled_variables_destroy(fv);
+	bool result = csp_solver_solve(solver, values, data, solve_type, checklist,
+		dataChecklist, stats
+	);
+
+	csp_solver_destroy(solver);
 
-	// Start the backtracking algorithm
 	return result;
 }
+
+SolveOutcome csp_problem_solve_limited(const CSPProblem *csp, size_t *values,
+	const void *data, SolveType solve_type, CSPValueChecklist *checklist,
+	CSPDataChecklist dataChecklist, const CSPSolveLimits *limits,
+	const atomic_bool *cancel, CSPSolveStats *stats
+){
+	assert(csp_initialised());
+
+	CSPSolver *solver = csp_solver_create(csp);
+	if (solver == NULL) {
+		return OUTCOME_UNKNOWN;
+	}
+	csp_solver_set_limits(solver, limits);
+	csp_solver_set_cancel(solver, cancel);
+
+	csp_solver_solve(solver, values, data, solve_type, checklist,
+		dataChecklist, stats
+	);
+	SolveOutcome outcome = csp_solver_get_outcome(solver);
+
+	csp_solver_destroy(solver);
+
+	return outcome;
+}
@@ -16,8 +16,72 @@
 
 #include <core/csp-problem.h>
 #include <solver/types-and-structs.h>
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
+
+/**
+ * The solver of a CSP problem. It owns the domains, the filled variables and
+ * the change stack of the search so that it can be reused across solves
+ * without allocating memory.
+ */
+typedef struct _CSPSolver CSPSolver;
+
+/**
+ * @brief The statistics of a solve. Only the nodes and the restarts are
+ * collected if the library is built without CSP_STATS.
+ * @var nodes The number of nodes visited, the root and the consistent
+ * assignments.
+ * @var restarts The number of restarts.
+ * @var decisions The number of values assigned.
+ * @var backtracks The number of decisions left once all their values were
+ * tried.
+ * @var checks The number of calls to the check functions of the constraints.
+ * @var pruned The number of values removed from the domains by the reduction
+ * and the propagation.
+ * @var wipeouts The number of domains wiped out by forward checking or MAC.
+ * @var max_depth The largest number of decisions of a branch.
+ * @var trail_peak The largest number of changes in the change stack.
+ * @var preprocess_time The seconds spent reducing the domains and propagating
+ * the constraints at the root.
+ * @var search_time The seconds spent searching.
+ */
+typedef struct {
+	uint64_t nodes;
+	uint64_t restarts;
+	uint64_t decisions;
+	uint64_t backtracks;
+	uint64_t checks;
+	uint64_t pruned;
+	uint64_t wipeouts;
+	size_t max_depth;
+	size_t trail_peak;
+	double preprocess_time;
+	double search_time;
+} CSPSolveStats;
+
+/**
+ * @brief The limits of a solve, 0 meaning no limit.
+ * @var time The seconds of wall-clock time from the start of the solve.
+ * @var nodes The number of nodes visited.
+ * @var trail The number of changes in the change stack.
+ */
+typedef struct {
+	double time;
+	uint64_t nodes;
+	size_t trail;
+} CSPSolveLimits;
+
+/**
+ * The outcome of a solve, UNKNOWN if a limit was hit or the solve was
+ * cancelled before the search was over.
+ */
+typedef enum {
+	OUTCOME_UNSAT = 0,
+	OUTCOME_SAT = 1,
+	OUTCOME_UNKNOWN = 2,
+} SolveOutcome;
 
 /**
  * Reduce the domains of the variables based on the data provided.
@@ -26,10 +90,14 @@
  * @param data The data to pass to the check function.
  * @param domains The domains of the variables.
  * @param dataChecklist A pointer to function to get the list of constraints
- * affected by the contents of data for the current variable.
+ * affected by the contents of data for the current variable, or NULL to use
+ * the unary constraints of the finalised CSP problem.
+ * @param checks The buffer receiving the constraints of the checklist, of at
+ * least csp->num_constraints entries, unused if dataChecklist is NULL.
  */
 extern void reduce_domains(const CSPProblem* csp, size_t* values,
-	const void* data, Domain** domains, CSPDataChecklist dataChecklist
+	const void* data, Domain** domains, CSPDataChecklist dataChecklist,
+	CSPConstraint** checks
 );
 
 /** Verify if the CSP problem is consistent at the specified index.
@@ -39,32 +107,215 @@ extern void reduce_domains(const CSPProblem* csp, size_t* values,
  * @param index The index of the current variable.
  * @param fv The FilledVariables structure to track filled variables.
  * @param checklist A pointer to function to get the list of necessary
- * constraints for the current variable.
+ * constraints for the current variable, or NULL to verify the constraints of
+ * the finalised CSP problem whose variables are all filled, but the unary ones
+ * enforced by #reduce_domains.
+ * @param checks The buffer receiving the constraints of the checklist, of at
+ * least csp->num_constraints entries, unused if checklist is NULL.
  * @return true if the CSP problem is consistent, false otherwise.
  * @pre The csp library is initialised.
+ * @pre checklist != NULL or the CSP problem is finalised.
  */
 extern bool csp_problem_is_consistent(const CSPProblem* csp, const size_t* values,
 	const void* data, size_t index, FilledVariables* fv,
-	CSPValueChecklist* checklist
+	CSPValueChecklist* checklist, CSPConstraint** checks
 );
 
 /** Solve the CSP problem using backtracking.
  * @param csp The CSP problem to solve.
  * @param values The values of the variables.
  * @param data The data to pass to the check function.
- * @param solve_type The type of solving to use (FC, OVARS, OVALS).
+ * @param solve_type The type of solving to use (FC, MAC, CBJ, OVARS, OVALS).
  * @param checklist A pointer to function to get the list of necessary
- * constraints for the current variable.
+ * constraints for the current variable, or NULL to use the constraints index
+ * of the finalised CSP problem.
  * @param dataChecklist A pointer to function to get the list of constraints
- * affected by the contents of data for the current variable.
- * @param benchmark pointer to Node counter for benchmarking, NULL if no
- * benchmarking required
+ * affected by the contents of data for the current variable, or NULL to use
+ * the unary constraints of the finalised CSP problem.
+ * @param stats The statistics of the solve, NULL if not required.
  * @return true if the CSP problem is solved, false otherwise.
  * @pre The csp library is initialised.
+ * @pre checklist != NULL or the CSP problem is finalised.
+ * @pre The CSP problem is finalised if solve_type has MAC, OVALS_SUPPORTS or
+ * OVARS_DOMWDEG.
  * @post The values are assigned to the solution.
+ * @note CBJ jumps back over the decisions which did not remove values involved
+ * in the failures of forward checking, other failures being blamed on every
+ * decision.
  */
 extern bool csp_problem_solve(const CSPProblem* csp, size_t* values,
 	const void* data, SolveType solve_type,
 	CSPValueChecklist* checklist, CSPDataChecklist* dataChecklist,
-	size_t* benchmark
+	CSPSolveStats* stats
+);
+
+/** Solve the CSP problem using backtracking, within limits.
+ * @param csp The CSP problem to solve.
+ * @param values The values of the variables.
+ * @param data The data to pass to the check function.
+ * @param solve_type The type of solving to use (FC, MAC, CBJ, OVARS, OVALS).
+ * @param checklist A pointer to function to get the list of necessary
+ * constraints for the current variable, or NULL to use the constraints index
+ * of the finalised CSP problem.
+ * @param dataChecklist A pointer to function to get the list of constraints
+ * affected by the contents of data for the current variable, or NULL to use
+ * the unary constraints of the finalised CSP problem.
+ * @param limits The limits of the solve, NULL if there are none.
+ * @param cancel The flag cancelling the solve once set by another thread, NULL
+ * if the solve cannot be cancelled.
+ * @param stats The statistics of the solve, NULL if not required.
+ * @return The outcome of the solve, OUTCOME_UNKNOWN if the solver could not be
+ * created.
+ * @pre The csp library is initialised.
+ * @pre checklist != NULL or the CSP problem is finalised.
+ * @pre The CSP problem is finalised if solve_type has MAC, OVALS_SUPPORTS or
+ * OVARS_DOMWDEG.
+ * @post The values are assigned to the solution if the outcome is
+ * OUTCOME_SAT.
+ */
+extern SolveOutcome csp_problem_solve_limited(const CSPProblem* csp,
+	size_t* values, const void* data, SolveType solve_type,
+	CSPValueChecklist* checklist, CSPDataChecklist* dataChecklist,
+	const CSPSolveLimits* limits, const atomic_bool* cancel,
+	CSPSolveStats* stats
+);
+
+/**
+ * Create a solver sized for the specified CSP problem.
+ * @param csp The CSP problem to solve.
+ * @return The solver created or NULL if an error occurred.
+ * @pre The csp library is initialised.
+ * @post The solver is bound to the CSP problem.
+ * @note The solver keeps every state and counter of its searches, so that
+ * several solvers can solve the same CSP problem on concurrent threads. A
+ * solver must not be used by two threads at once.
+ */
+extern CSPSolver* csp_solver_create(const CSPProblem* csp);
+
+/**
+ * Destroy the solver.
+ * @param solver The solver to destroy.
+ * @pre The csp library is initialised.
+ * @post The buffers of the solver are freed.
+ * @post The solver is freed.
+ */
+extern void csp_solver_destroy(CSPSolver* solver);
+
+/**
+ * Bind the solver to another CSP problem of the same shape.
+ * @param solver The solver to reset.
+ * @param csp The CSP problem to solve.
+ * @return true if the CSP problem fits in the solver buffers, false otherwise.
+ * @pre The csp library is initialised.
+ * @post The solver is bound to the CSP problem if it has the same number of
+ * domains, at most the same number of constraints and domains at most as large
+ * as the ones the solver was created for.
+ * @note The domains, the change stack and the buffers of the search are kept.
+ * The arcs of the constraints and the residues of MAC are kept too, and only
+ * allocated again when the CSP problem has more of them than the previous
+ * ones. The current tables of the table constraints are allocated again.
+ */
+extern bool csp_solver_reset(CSPSolver* solver, const CSPProblem* csp);
+
+/**
+ * Set the restart strategy of the solver. The search restarts from the root
+ * once it failed as many times as the budget, which is base times the terms of
+ * the Luby sequence, or base multiplied by factor at each restart. The
+ * decisions refuted before a restart are recorded as nogoods, so that no
+ * subtree is explored twice.
+ * @param solver The solver.
+ * @param restart_type The restart strategy, RESTARTS_NONE by default.
+ * @param base The number of failures before the first restart.
+ * @param factor The growth of the budget of RESTARTS_GEOMETRIC.
+ * @pre The csp library is initialised.
+ * @pre base > 0 unless restart_type is RESTARTS_NONE.
+ * @pre factor >= 1 if restart_type is RESTARTS_GEOMETRIC.
+ */
+extern void csp_solver_set_restarts(CSPSolver* solver,
+	RestartType restart_type, size_t base, double factor
+);
+
+/**
+ * Set the seed breaking the ties of the variable heuristics at random, so that
+ * restarts explore different trees.
+ * @param solver The solver.
+ * @param seed The seed, 0 to break the ties by index as by default.
+ * @pre The csp library is initialised.
+ * @post Each solve starts the generator from the seed.
+ */
+extern void csp_solver_set_seed(CSPSolver* solver, uint64_t seed);
+
+/**
+ * Set the limits of the solves of the solver. The search gives up once it
+ * visited as many nodes, once the change stack holds as many changes, or
+ * shortly after the time is over, the clock being read every few decisions.
+ * @param solver The solver.
+ * @param limits The limits, NULL to remove them as by default.
+ * @pre The csp library is initialised.
+ * @post The limits are copied.
+ */
+extern void csp_solver_set_limits(CSPSolver* solver,
+	const CSPSolveLimits* limits
+);
+
+/**
+ * Set the flag cancelling the solves of the solver. It is read before each
+ * decision, so another thread can set it to stop the search shortly after.
+ * @param solver The solver.
+ * @param cancel The flag, NULL if the solves cannot be cancelled as by
+ * default.
+ * @pre The csp library is initialised.
+ * @note The parallel and portfolio solves use their own flags.
+ */
+extern void csp_solver_set_cancel(CSPSolver* solver,
+	const atomic_bool* cancel
+);
+
+/**
+ * Get the outcome of the last solve of the solver.
+ * @param solver The solver.
+ * @return The outcome, OUTCOME_UNKNOWN if a limit was hit or the solve was
+ * cancelled.
+ * @pre The csp library is initialised.
+ */
+extern SolveOutcome csp_solver_get_outcome(const CSPSolver* solver);
+
+/**
+ * Get the number of restarts of the last solve of the solver.
+ * @param solver The solver.
+ * @return The number of restarts.
+ * @pre The csp library is initialised.
+ */
+extern size_t csp_solver_get_restarts(const CSPSolver* solver);
+
+/** Solve the CSP problem bound to the solver using backtracking.
+ * @param solver The solver to use.
+ * @param values The values of the variables.
+ * @param data The data to pass to the check function.
+ * @param solve_type The type of solving to use (FC, MAC, CBJ, OVARS, OVALS).
+ * @param checklist A pointer to function to get the list of necessary
+ * constraints for the current variable, or NULL to use the constraints index
+ * of the finalised CSP problem.
+ * @param dataChecklist A pointer to function to get the list of constraints
+ * affected by the contents of data for the current variable, or NULL to use
+ * the unary constraints of the finalised CSP problem.
+ * @param stats The statistics of the solve, NULL if not required.
+ * @return true if the CSP problem is solved, false if it has no solution or
+ * the solve was stopped, as told by csp_solver_get_outcome.
+ * @pre The csp library is initialised.
+ * @pre checklist != NULL or the CSP problem is finalised.
+ * @pre The CSP problem is finalised if solve_type has MAC, OVALS_SUPPORTS or
+ * OVARS_DOMWDEG.
+ * @post The values are assigned to the solution.
+ * @note CBJ jumps back over the decisions which did not remove values involved
+ * in the failures of forward checking, other failures being blamed on every
+ * decision.
+ * @note The search does not allocate memory nor recurse, the domains are
+ * reset from the CSP problem at each call. Only the first MAC solve allocates
+ * the supports of the binary constraints.
+ */
+extern bool csp_solver_solve(CSPSolver* solver, size_t* values,
+	const void* data, SolveType solve_type,
+	CSPValueChecklist* checklist, CSPDataChecklist* dataChecklist,
+	CSPSolveStats* stats
 );
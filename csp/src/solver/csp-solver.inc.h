@@ -0,0 +1,543 @@
+/**
+ * @file csp-solver.inc.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ * @copyright GNU Lesser General Public License v3.0
+ */
+
+#pragma once
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "core/csp-constraint.h"
+#include "core/csp-problem.h"
+#include "solver/csp-solver.h"
+#include "solver/csp-solver-enumerate.h"
+#include "solver/csp-solver-incremental.h"
+#include "solver/csp-solver-minimize.h"
+#include "solver/csp-solver-trace.h"
+#include "solver/types-and-structs.h"
+
+/**
+ * @brief A decision of the search, the variable being assigned at a depth.
+ * @var index The index of the variable.
+ * @var position The position in the domain of the next value to try.
+ * @var end The position in the domain after the last value to try, the values
+ * after it being searched by other threads.
+ * @var stack_start The top of the change stack before the assignment.
+ * @var table_start The top of the table trail before the assignment.
+ * @var nogood_start The top of the change stack before the propagation of the
+ * nogoods, the changes after it being caused by several decisions.
+ */
+typedef struct {
+	size_t index;
+	size_t position;
+	size_t end;
+	size_t stack_start;
+	size_t table_start;
+	size_t nogood_start;
+} CSPSolverFrame;
+
+/**
+ * @brief The current table of a table constraint of allowed tuples, the set of
+ * its tuples whose values are all left, kept by Compact-Table filtering.
+ * @var constraint The table constraint.
+ * @var num_words The number of words of the current table.
+ * @var words The words of the current table.
+ * @var index The indexes of the words, the non-zero ones first.
+ * @var limit The number of non-zero words.
+ * @var sizes The size of the domain of each variable of the constraint at the
+ * last revision, SIZE_MAX before the first one and 0 once it is filled.
+ * @var residues The word of the last support found for each value of each
+ * variable of the constraint, the values of a variable following the ones of
+ * the previous variable.
+ */
+typedef struct {
+	const CSPConstraint *constraint;
+	size_t num_words;
+	uint64_t *words;
+	size_t *index;
+	size_t limit;
+	size_t *sizes;
+	size_t *residues;
+} CSPSolverTable;
+
+/**
+ * @brief A change of a current table, undone on backtrack.
+ * @var table The index of the current table.
+ * @var slot The index of the word changed, or num_words plus the index of the
+ * variable whose size changed.
+ * @var value The word or the size before the change.
+ */
+typedef struct {
+	size_t table;
+	size_t slot;
+	uint64_t value;
+} CSPSolverTableChange;
+
+/**
+ * @brief A literal of a nogood, the assignment of a value to a variable.
+ * @var variable The index of the variable.
+ * @var value The value.
+ */
+typedef struct {
+	size_t variable;
+	size_t value;
+} CSPSolverLiteral;
+
+/**
+ * @brief An assumption of the solves, a value a variable takes or not.
+ * @var variable The index of the variable.
+ * @var value The value.
+ * @var fixed Whether the variable takes the value, or does not.
+ */
+typedef struct {
+	size_t variable;
+	size_t value;
+	bool fixed;
+} CSPSolverAssumption;
+
+/**
+ * @brief The work shared by the threads of a parallel search.
+ */
+typedef struct _CSPSolverPool CSPSolverPool;
+
+/**
+ * @brief The solver of a CSP problem, owning every buffer used by the search.
+ * @var csp The CSP problem to solve.
+ * @var num_domains The number of variables the solver is sized for.
+ * @var num_constraints The number of constraints the solver is sized for.
+ * @var capacities The number of values each domain is sized for.
+ * @var fv The filled variables.
+ * @var domains The domains of the variables.
+ * @var change_stack The stack of changes made during forward checking.
+ * @var stack_top The top of the change stack.
+ * @var root_top The top of the change stack at the root of the search.
+ * @var base_top The top of the change stack at the root of the search before
+ * the assumptions.
+ * @var checks The buffer receiving the constraints of the checklists.
+ * @var frames The decisions of the search, one per assigned variable.
+ * @var depth The number of decisions of the search.
+ * @var stats The statistics of the last search.
+ * @var scores The scores of the values of a domain, indexed by value, sized for
+ * the largest domain.
+ * @var supports The number of supports of each value of each variable at the
+ * root of the search, indexed by value.
+ * @var weights The weight of each constraint, the number of domain wipeouts it
+ * caused during the solve plus one.
+ * @var restart_type The restart strategy.
+ * @var restart_base The number of failures before the first restart.
+ * @var restart_factor The growth of the failures between restarts of the
+ * geometric strategy.
+ * @var seed The seed breaking the ties of the variable heuristics, 0 to
+ * break them by index.
+ * @var random The state of the generator breaking the ties.
+ * @var literals The literals of the nogoods, nogood after nogood.
+ * @var num_literals The number of literals.
+ * @var literals_capacity The number of literals allocated.
+ * @var nogood_starts The index of the first literal of each nogood, and the
+ * number of literals after the last one.
+ * @var num_nogoods The number of nogoods.
+ * @var nogoods_capacity The number of nogoods allocated.
+ * @var watches The two watched literals of each nogood, the entry of a
+ * nogood watch being 2 * nogood + slot.
+ * @var watch_next The next entry watching a literal of the same variable,
+ * SIZE_MAX for the last one.
+ * @var watch_heads The first entry watching a literal of each variable,
+ * SIZE_MAX if there is none.
+ * @var units The literals refuted at the root of the search, removed from
+ * the domains at the next restart.
+ * @var num_units The number of units.
+ * @var conflict_words The number of words of a conflict set.
+ * @var conflicts The conflict set of each depth, a bitset of the depths
+ * responsible for the failures below it, NULL if it would take too much
+ * memory.
+ * @var num_arcs The number of (variable, constraint) pairs of the finalised
+ * CSP problem, 0 if it is not finalised.
+ * @var arc_capacity The number of arcs arc_mirrors and residue_offsets can
+ * hold, kept from a CSP problem to the next one.
+ * @var arc_bases The index of the first arc of each variable, its k-th
+ * constraint being its arc arc_bases[variable] + k.
+ * @var arc_mirrors The arc of the other variable of each binary constraint
+ * arc, SIZE_MAX for the other arcs.
+ * @var nary Whether the finalised CSP problem has constraints of more than two
+ * variables.
+ * @var num_tables The number of table constraints of allowed tuples of the
+ * finalised CSP problem, which MAC revises by Compact-Table filtering.
+ * @var tables The current table of each of these constraints, NULL if there
+ * are none.
+ * @var table_ids The index of the current table of each constraint, SIZE_MAX
+ * for the other constraints.
+ * @var table_mask The mask of the tuples of a revision, of the words of the
+ * largest table.
+ * @var table_trail The changes of the current tables, undone on backtrack.
+ * @var table_top The top of the table trail.
+ * @var root_table_top The top of the table trail at the root of the search.
+ * @var base_table_top The top of the table trail at the root of the search
+ * before the assumptions.
+ * @var queue The propagation queue of variables, circular.
+ * @var queued Whether each variable is in the propagation queue.
+ * @var residue_offsets The index of the residues of each arc, NULL until the
+ * first MAC solve.
+ * @var residues_indexed Whether the residues were indexed for the CSP problem.
+ * @var num_residues The number of residues, 0 if there are none.
+ * @var residue_capacity The number of residues residues can hold, kept from a
+ * CSP problem to the next one.
+ * @var residues The last support found in the domain of the other variable
+ * for each value of each binary constraint arc.
+ * @var limits The limits of the solves.
+ * @var limited Whether the solves have a limit.
+ * @var deadline The time of the monotonic clock at which the solve is over.
+ * @var ticks The decisions left before the clock is read again.
+ * @var interrupted Whether the last search was stopped before it was over.
+ * @var outcome The outcome of the last solve.
+ * @var stop The flag stopping the search once set by another thread, NULL if
+ * the search cannot be stopped.
+ * @var pool The work shared with the other threads of a parallel search, NULL
+ * if the search is not parallel.
+ * @var hungry The number of threads of the pool waiting for work.
+ * @var enumerating Whether the search goes on after each solution.
+ * @var callback The callback receiving the solutions of an enumeration, NULL
+ * to only count them.
+ * @var callback_arg The argument to pass to the callback.
+ * @var solutions The number of solutions found by the last enumeration.
+ * @var objective The objective of a minimization, NULL if the enumeration
+ * does not minimize.
+ * @var bound The lower bound of the objective in a subtree, NULL if the
+ * subtrees are not pruned.
+ * @var best_cost The objective of the best solution of the minimization.
+ * @var best The values of the best solution of the minimization.
+ * @var incremental Whether the root of the search is kept between solves.
+ * @var root_ready Whether the domains hold the root of the previous solve,
+ * from the bottom of the change stack to base_top.
+ * @var root_mac Whether the kept root was made arc consistent.
+ * @var root_checklist The data checklist which reduced the kept root.
+ * @var assumptions The assumptions of the solves.
+ * @var num_assumptions The number of assumptions.
+ * @var assumptions_capacity The number of assumptions allocated.
+ * @var nogoods_assumed Whether nogoods were learnt under assumptions.
+ * @var bucketed Whether the search chooses its variables from the buckets.
+ * @var bucket_order The variables sorted by key, the key of a variable being 0
+ * if it is filled and its domain size plus one if not.
+ * @var bucket_positions The position of each variable in the order.
+ * @var bucket_keys The key of each variable in the order.
+ * @var bucket_starts The position of the first variable of each key in the
+ * order, and the number of variables after the last one.
+ * @var num_buckets The number of keys.
+ * @var bucket_synced The top of the change stack up to which the changes are
+ * reflected in the order.
+ * @var trace The hook receiving the events of the search, NULL if the search
+ * is not traced.
+ * @var trace_arg The argument to pass to the trace hook.
+ */
+struct _CSPSolver {
+	const CSPProblem *csp;
+	size_t num_domains;
+	size_t num_constraints;
+	size_t *capacities;
+	FilledVariables *fv;
+	Domain **domains;
+	DomainChange *change_stack;
+	size_t stack_top;
+	size_t root_top;
+	size_t base_top;
+	CSPConstraint **checks;
+	CSPSolverFrame *frames;
+	size_t depth;
+	CSPSolveStats stats;
+	size_t *scores;
+	size_t **supports;
+	size_t *weights;
+	RestartType restart_type;
+	size_t restart_base;
+	double restart_factor;
+	uint64_t seed;
+	uint64_t random;
+	CSPSolverLiteral *literals;
+	size_t num_literals;
+	size_t literals_capacity;
+	size_t *nogood_starts;
+	size_t num_nogoods;
+	size_t nogoods_capacity;
+	size_t *watches;
+	size_t *watch_next;
+	size_t *watch_heads;
+	CSPSolverLiteral *units;
+	size_t num_units;
+	size_t conflict_words;
+	uint64_t *conflicts;
+	size_t num_arcs;
+	size_t arc_capacity;
+	size_t *arc_bases;
+	size_t *arc_mirrors;
+	bool nary;
+	size_t num_tables;
+	CSPSolverTable *tables;
+	size_t *table_ids;
+	uint64_t *table_mask;
+	CSPSolverTableChange *table_trail;
+	size_t table_top;
+	size_t root_table_top;
+	size_t base_table_top;
+	size_t *queue;
+	bool *queued;
+	size_t *residue_offsets;
+	bool residues_indexed;
+	size_t num_residues;
+	size_t residue_capacity;
+	size_t *residues;
+	CSPSolveLimits limits;
+	bool limited;
+	double deadline;
+	size_t ticks;
+	bool interrupted;
+	SolveOutcome outcome;
+	const atomic_bool *stop;
+	CSPSolverPool *pool;
+	const atomic_size_t *hungry;
+	bool enumerating;
+	CSPSolutionCallback *callback;
+	void *callback_arg;
+	uint64_t solutions;
+	CSPObjective *objective;
+	CSPLowerBound *bound;
+	double best_cost;
+	size_t *best;
+	bool incremental;
+	bool root_ready;
+	bool root_mac;
+	CSPDataChecklist *root_checklist;
+	CSPSolverAssumption *assumptions;
+	size_t num_assumptions;
+	size_t assumptions_capacity;
+	bool nogoods_assumed;
+	bool bucketed;
+	size_t *bucket_order;
+	size_t *bucket_positions;
+	size_t *bucket_keys;
+	size_t *bucket_starts;
+	size_t num_buckets;
+	size_t bucket_synced;
+	CSPTraceHook *trace;
+	void *trace_arg;
+};
+
+// INTERNAL FUNCTIONS
+/**
+ * @brief Reset the solver to the root of the search, the domains being reduced
+ * and made arc consistent if solve_type has MAC.
+ * @param solver The solver.
+ * @param values The values of the variables.
+ * @param data The data to pass to the check function.
+ * @param solve_type The type of solving to use.
+ * @param dataChecklist A pointer to function to get the list of constraints
+ * affected by the contents of data for the current variable, or NULL to use
+ * the unary constraints of the finalised CSP problem.
+ * @return false if a domain was wiped out at the root, true otherwise.
+ * @post The top of the change stack at the root is kept in root_top.
+ */
+extern bool csp_solver_prepare(CSPSolver *solver, size_t *values,
+	const void *data, SolveType solve_type, CSPDataChecklist dataChecklist
+);
+/**
+ * @brief Search the subtree below the decisions of a path from the root of
+ * the search.
+ * @param solver The solver, prepared.
+ * @param values The values of the variables.
+ * @param data The data to pass to the check function.
+ * @param solve_type The type of solving to use.
+ * @param checklist A pointer to function to get the list of necessary
+ * constraints for the current variable, or NULL to use the constraints index
+ * of the finalised CSP problem.
+ * @param path The decisions of the path, from the root.
+ * @param length The number of decisions of the path.
+ * @return true if a solution was found in the subtree, false otherwise.
+ * @pre The solver does not restart if length > 0.
+ */
+extern bool csp_solver_search(CSPSolver *solver, size_t *values,
+	const void *data, SolveType solve_type, CSPValueChecklist *checklist,
+	const CSPSolverLiteral *path, size_t length
+);
+/**
+ * @brief Give away the last value left to try of the shallowest decision
+ * which has one, as the path of its subtree.
+ * @param solver The solver.
+ * @param values The values of the variables.
+ * @param path The buffer receiving the decisions of the path, of at least
+ * num_domains entries.
+ * @return The number of decisions of the path, 0 if no decision has a value
+ * left to give.
+ * @post The decision no longer tries the value, and no longer jumps back over
+ * the decisions above it.
+ */
+extern size_t csp_solver_split(CSPSolver *solver, const size_t *values,
+	CSPSolverLiteral *path
+);
+/**
+ * @brief Add the statistics of a search to the ones of several searches.
+ * @param total The statistics of the searches.
+ * @param stats The statistics of the search to add.
+ * @param concurrent Whether the searches run at once, their times being the
+ * longest one instead of their sum.
+ */
+extern void csp_solver_merge_stats(CSPSolveStats *total,
+	const CSPSolveStats *stats, bool concurrent
+);
+/**
+ * @brief Share a subtree of the search of the solver with the threads of its
+ * pool waiting for work.
+ * @param solver The solver.
+ * @param values The values of the variables.
+ */
+extern void csp_solver_share(CSPSolver *solver, const size_t *values);
+/**
+ * @brief Apply the assumptions of the solver to the domains.
+ * @param solver The solver.
+ * @return false if a domain was wiped out, true otherwise.
+ * @post The changes of the domains are recorded in the change stack.
+ */
+extern bool csp_solver_apply_assumptions(CSPSolver *solver);
+/**
+ * @brief Find the only unfilled variable of a constraint.
+ * @param constraint The constraint.
+ * @param excluded A variable counted as filled, SIZE_MAX if there is none.
+ * @param fv The filled variables.
+ * @return The variable, SIZE_MAX if there is none or several of them.
+ */
+extern size_t csp_solver_last_unfilled(const CSPConstraint *constraint,
+	size_t excluded, const FilledVariables *fv
+);
+/**
+ * @brief Index the residues of the arcs of the solver if they fit, reusing
+ * the buffers of the previous CSP problem when they are large enough.
+ * @param solver The solver.
+ * @post The residues are reset, or there are none if they would take too much
+ * memory.
+ */
+extern void csp_solver_prepare_residues(CSPSolver *solver);
+/**
+ * @brief Allocate the current tables of the table constraints of allowed
+ * tuples of the finalised CSP problem bound to the solver.
+ * @param solver The solver, without current tables.
+ * @return false if an error occurred, true otherwise.
+ */
+extern bool csp_solver_index_tables(CSPSolver *solver);
+/**
+ * @brief Free the current tables of the solver.
+ * @param solver The solver.
+ * @post The solver has no current tables.
+ */
+extern void csp_solver_free_tables(CSPSolver *solver);
+/**
+ * @brief Reset the current tables of the solver to all their tuples.
+ * @param solver The solver.
+ * @post The table trail is empty.
+ */
+extern void csp_solver_prepare_tables(CSPSolver *solver);
+/**
+ * @brief Undo the changes of the current tables down to a top of the table
+ * trail.
+ * @param solver The solver.
+ * @param top The top of the table trail to go back to.
+ */
+extern void csp_solver_restore_tables(CSPSolver *solver, size_t top);
+/**
+ * @brief Forget the nogoods of the solver.
+ * @param solver The solver.
+ */
+extern void csp_solver_clear_nogoods(CSPSolver *solver);
+/**
+ * @brief Record the decisions refuted on the current branch of the search as
+ * nogoods, the assignments of the decisions above them forbidding them.
+ * @param solver The solver.
+ * @param values The values of the variables.
+ * @post The refuted decisions of the first level are stored as units, the
+ * other ones as nogoods if they fit in memory.
+ */
+extern void csp_solver_record_nogoods(CSPSolver *solver, const size_t *values);
+/**
+ * @brief Remove the units of the solver from the domains.
+ * @param solver The solver.
+ * @return false if a domain was wiped out, true otherwise.
+ * @post The changes of the domains are recorded in the change stack.
+ */
+extern bool csp_solver_apply_units(CSPSolver *solver);
+/**
+ * @brief Propagate the nogoods watching the assignment of a variable.
+ * @param solver The solver.
+ * @param values The values of the variables.
+ * @param index The index of the variable which was assigned.
+ * @return false if a nogood is violated or a domain was wiped out, true
+ * otherwise.
+ * @post The values forbidden by the nogoods are removed from the domains of
+ * the unfilled variables, and the changes recorded in the change stack.
+ */
+extern bool csp_solver_propagate_nogoods(CSPSolver *solver,
+	const size_t *values, size_t index
+);
+/**
+ * @brief Sort the variables of the solver in buckets by domain size.
+ * @param solver The solver.
+ * @post The buckets reflect the filled variables and the domains.
+ */
+extern void csp_solver_build_buckets(CSPSolver *solver);
+/**
+ * @brief Reflect the changes of the change stack since the last
+ * synchronisation in the buckets.
+ * @param solver The solver, whose buckets are built.
+ */
+extern void csp_solver_sync_buckets(CSPSolver *solver);
+/**
+ * @brief Reflect the changes undone by a restoration of the change stack in
+ * the buckets.
+ * @param solver The solver, whose buckets are built.
+ * @pre The change stack was restored since the last call, the changes above
+ * its top being left in place.
+ */
+extern void csp_solver_restore_buckets(CSPSolver *solver);
+/**
+ * @brief Take a variable which was filled out of the buckets.
+ * @param solver The solver, whose buckets are built.
+ * @param variable The index of the variable.
+ */
+extern void csp_solver_fill_bucket(CSPSolver *solver, size_t variable);
+/**
+ * @brief Put a variable which was unfilled back in the buckets.
+ * @param solver The solver, whose buckets are built.
+ * @param variable The index of the variable.
+ * @pre The domain of the variable did not change while it was filled.
+ */
+extern void csp_solver_unfill_bucket(CSPSolver *solver, size_t variable);
+/**
+ * @brief Choose the unfilled variable of the smallest or largest domain from
+ * the buckets.
+ * @param solver The solver, whose buckets are built.
+ * @param largest Whether the largest domain is chosen.
+ * @return The index of the variable, chosen at random among the ties if the
+ * solver has a seed.
+ * @pre A variable is unfilled.
+ */
+extern size_t csp_solver_choose_bucket(CSPSolver *solver, bool largest);
+/**
+ * @brief Send an event of the search to the trace hook of the solver.
+ * @param solver The solver.
+ * @param type The type of the event.
+ * @param depth The number of decisions of the search at the event.
+ * @param variable The variable of the event, SIZE_MAX if there is none.
+ * @param value The value of the event, SIZE_MAX if there is none.
+ * @pre The solver has a trace hook.
+ */
+extern void csp_solver_trace(const CSPSolver *solver, TraceEventType type,
+	size_t depth, size_t variable, size_t value
+);
+/**
+ * @brief Send a prune event for each change of the change stack since start.
+ * @param solver The solver.
+ * @param start The top of the change stack before the changes.
+ * @pre The solver has a trace hook.
+ */
+extern void csp_solver_trace_prunes(const CSPSolver *solver, size_t start);
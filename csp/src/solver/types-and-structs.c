@@ -15,6 +15,13 @@
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+
+#include "util/bits.h"
+#include "util/stats.h"
+
+// Number of words a domain check function is given at once
+#define DOMAIN_FILTER_WORDS 16
 
 // Initialize the structure
 FilledVariables* filled_variables_create(size_t num_variables) {
@@ -175,6 +182,10 @@ size_t filled_variables_next_filled(const FilledVariables* fv,
 	return SIZE_MAX;
 }
 
+void filled_variables_clear(FilledVariables* fv) {
+	memset(fv->bitset, 0, (fv->size + 7) / 8);
+}
+
 // Free the structure
 void filled_variables_destroy(FilledVariables* fv) {
 	free(fv->bitset);
@@ -182,23 +193,158 @@ void filled_variables_destroy(FilledVariables* fv) {
 }
 
 Domain* domain_create(size_t size) {
-	Domain* domain = malloc(sizeof(Domain) + size * sizeof(size_t));
+	size_t num_words = (size + 63) / 64;	 // Round up to the nearest word
+	Domain* domain = malloc(sizeof(Domain) + 2 * size * sizeof(size_t)
+		+ num_words * sizeof(uint64_t)
+	);
 	if (domain == NULL) {
 		perror("malloc");
 		return NULL;
 	}
+	domain->size = size;
+	domain->num_words = num_words;
+	domain->positions = domain->values + size;
+	domain->words = (uint64_t*) (domain->positions + size);
+	domain_reset(domain, size);
+	return domain;
+}
+
+void domain_reset(Domain* domain, size_t size) {
+	assert(size <= domain->size);
 	domain->amount = size;
 	for (size_t i = 0; i < size; i++) {
 		domain->values[i] = i;
+		domain->positions[i] = i;
+	}
+	for (size_t i = 0; i < domain->num_words; i++) {
+		if (size >= (i + 1) * 64) {
+			domain->words[i] = UINT64_MAX;
+		} else if (size > i * 64) {
+			domain->words[i] = (UINT64_C(1) << (size % 64)) - 1;
+		} else {
+			domain->words[i] = 0;
+		}
 	}
-	return domain;
 }
 
 void domain_destroy(Domain* domain) { free(domain); }
 
+bool domain_contains(const Domain* domain, size_t value) {
+	return value < domain->size
+		&& domain->words[value / 64] & (UINT64_C(1) << (value % 64));
+}
+
+size_t domain_next(const Domain* domain, size_t value) {
+	size_t word = value / 64;
+	if (word >= domain->num_words) {
+		return SIZE_MAX;
+	}
+
+	// Ignore the values lower than value in the first word
+	uint64_t bits = domain->words[word] & (UINT64_MAX << (value % 64));
+	while (bits == 0) {
+		if (++word >= domain->num_words) {
+			return SIZE_MAX;
+		}
+		bits = domain->words[word];
+	}
+	return word * 64 + bits_ctz(bits);
+}
+
+void domain_remove(Domain* domain, size_t value) {
+	assert(domain_contains(domain, value));
+
+	// Swap the value with the last value left
+	size_t position = domain->positions[value];
+	size_t last = domain->values[--domain->amount];
+
+	domain->values[position] = last;
+	domain->positions[last] = position;
+	domain->values[domain->amount] = value;
+	domain->positions[value] = domain->amount;
+
+	domain->words[value / 64] &= ~(UINT64_C(1) << (value % 64));
+
+	STATS(stats_counters.pruned++);
+}
+
+void domain_keep_word(Domain* domain, size_t word, uint64_t keep) {
+	for (uint64_t removed = domain->words[word] & ~keep; removed;
+		removed &= removed - 1
+	) {
+		domain_remove(domain, word * 64 + bits_ctz(removed));
+	}
+}
+
+bool domain_filter(Domain* domain, const CSPConstraint* constraint,
+	size_t* values, const void* data, size_t variable
+) {
+	size_t amount = domain->amount;
+	CSPDomainChecker* domain_check = csp_constraint_get_domain_check(
+		constraint
+	);
+
+	if (domain_check == NULL) {
+		// Filter the values left, from the last one so that a removed value is
+		// swapped with an already checked one
+		CSPChecker* check = csp_constraint_get_check(constraint);
+		for (size_t j = amount; j-- > 0;) {
+			values[variable] = domain->values[j];
+
+			STATS(stats_counters.checks++);
+			if (!check(constraint, values, data)) {
+				domain_remove(domain, values[variable]);
+			}
+		}
+		return domain->amount < amount;
+	}
+
+	// Check the bitset by slices, the kept bits being applied to each slice
+	// once it is checked
+	uint64_t keep[DOMAIN_FILTER_WORDS];
+	for (size_t w = 0; w < domain->num_words; w += DOMAIN_FILTER_WORDS) {
+		size_t count = domain->num_words - w < DOMAIN_FILTER_WORDS
+			? domain->num_words - w : DOMAIN_FILTER_WORDS;
+
+		STATS(stats_counters.checks++);
+		domain_check(constraint, values, data, variable, w * 64,
+			&domain->words[w], count, keep
+		);
+		for (size_t k = 0; k < count; k++) {
+			domain_keep_word(domain, w + k, keep[k]);
+		}
+	}
+	return domain->amount < amount;
+}
+
+void domain_sort(Domain* domain, const size_t* keys) {
+	// Insertion sort, domains are small and often almost sorted
+	for (size_t i = 1; i < domain->amount; i++) {
+		size_t value = domain->values[i];
+		size_t j = i;
+		for (; j > 0 && keys[domain->values[j - 1]] > keys[value]; j--) {
+			domain->values[j] = domain->values[j - 1];
+			domain->positions[domain->values[j]] = j;
+		}
+		domain->values[j] = value;
+		domain->positions[value] = j;
+	}
+}
+
+void domain_restore(Domain* domain, size_t amount) {
+	// The removed values are kept in removal order after the values left
+	for (size_t i = domain->amount; i < amount; i++) {
+		size_t value = domain->values[i];
+		domain->words[value / 64] |= UINT64_C(1) << (value % 64);
+	}
+	domain->amount = amount;
+}
+
 void print_domain(const Domain* domain) {
-	for (size_t i = 0; i < domain->amount; i++) {
-		printf("%zu ", domain->values[i]);
+	for (size_t value = domain_next(domain, 0); value != SIZE_MAX;
+		value = domain_next(domain, value + 1)
+	) {
+		printf("%zu ", value);
 	}
 	printf("\n");
 }
@@ -226,17 +372,15 @@ void domain_change_stack_restore(const DomainChange* stack, size_t* stack_top,
 	while (*stack_top > *stop_point) {
 		// Only restore changes until stop point
 		(*stack_top)--;
-		size_t domain_index = stack[*stack_top].domain_index;
-		size_t value = stack[*stack_top].value;
-
-		domains[domain_index]->values[domains[domain_index]->amount] = value;
-		domains[domain_index]->amount++;
+		domain_restore(domains[stack[*stack_top].domain_index],
+			stack[*stack_top].amount
+		);
 	}
 }
 
 void domain_change_stack_add(DomainChange* stack, size_t* stack_top,
-														 size_t domain_index, size_t value) {
+														 size_t domain_index, size_t amount) {
 	stack[*stack_top].domain_index = domain_index;
-	stack[*stack_top].value = value;
+	stack[*stack_top].amount = amount;
 	(*stack_top)++;
-}
\ No newline at end of file
+}
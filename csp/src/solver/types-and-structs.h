@@ -14,6 +14,7 @@
 #error "Only <csp/csp.h> can be included directly."
 #endif
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -25,25 +26,43 @@ typedef enum {
 	OVARS_MIN = 2,
 	OVARS_MAX = 4,
 	OVALS = 8,
+	MAC = 16,
+	OVALS_SUPPORTS = 32,
+	OVARS_DOMWDEG = 64,
+	CBJ = 128,
 } SolveType;
 
+typedef enum {
+	RESTARTS_NONE = 0,
+	RESTARTS_LUBY = 1,
+	RESTARTS_GEOMETRIC = 2,
+} RestartType;
+
 /**
  * Structure to represent the domain of a variable in a CSP problem.
- * It contains the number of values in the domain and an array of values.
+ * It is a sparse set: the values left are the first amount ones of an array
+ * holding every value, and the position of each value in this array is
+ * indexed. It also keeps a bitset of 64-bit words where the bit v is set if
+ * the value v is left.
  */
 typedef struct {
-	size_t amount;
-	size_t values[];
+	size_t amount;			// Number of values left
+	size_t size;				// Number of values the domain was created with
+	size_t num_words;		// Number of words of the bitset
+	uint64_t* words;		// Bitset of the values left
+	size_t* positions;	// Position of each value in values
+	size_t values[];		// Values, the ones left first
 } Domain;
 
 /**
  * Structure to track changes in the domain of a variable during forward
  * checking. Use as a stack to store the changes.
- * It stores the index of the domain and the value that was removed.
+ * It stores the index of the domain and its amount of values before the
+ * change, the removed values being kept after the values left.
  */
 typedef struct {
 	size_t domain_index;
-	size_t value;
+	size_t amount;
 } DomainChange;
 
 /**
@@ -139,6 +158,12 @@ extern size_t filled_variables_next_filled(const FilledVariables* fv,
  */
 extern FilledVariables* filled_variables_create(size_t num_variables);
 
+/**
+ * Mark every variable as unfilled.
+ * @param fv The FilledVariables structure.
+ */
+extern void filled_variables_clear(FilledVariables* fv);
+
 /**
  * Free the memory allocated for a FilledVariables structure.
  * @param fv The FilledVariables structure to free.
@@ -152,12 +177,88 @@ extern void filled_variables_destroy(FilledVariables* fv);
  */
 extern Domain* domain_create(size_t size);
 
+/**
+ * Fill a Domain structure with the values from 0 to size - 1.
+ * @param domain The Domain structure to reset.
+ * @param size The size of the domain.
+ * @pre size is not greater than the size the domain was created with.
+ */
+extern void domain_reset(Domain* domain, size_t size);
+
 /**
  * Free the memory allocated for a Domain structure.
  * @param domain The Domain structure to free.
  */
 extern void domain_destroy(Domain* domain);
 
+/**
+ * Check if a value is in a Domain structure.
+ * @param domain The Domain structure.
+ * @param value The value to check.
+ * @return true if the value is in the domain, false otherwise.
+ */
+extern bool domain_contains(const Domain* domain, size_t value);
+
+/**
+ * Get the next value of a Domain structure in increasing order.
+ * @param domain The Domain structure.
+ * @param value The value to start searching from.
+ * @return The smallest value of the domain not lower than value, or SIZE_MAX
+ * if there is none.
+ */
+extern size_t domain_next(const Domain* domain, size_t value);
+
+/**
+ * Remove a value from a Domain structure by swapping it with the last value
+ * left.
+ * @param domain The Domain structure.
+ * @param value The value to remove.
+ * @pre The value is in the domain.
+ */
+extern void domain_remove(Domain* domain, size_t value);
+
+/**
+ * Remove the values of a word of a Domain structure that are not kept.
+ * @param domain The Domain structure.
+ * @param word The index of the word.
+ * @param keep The bits of the values to keep.
+ */
+extern void domain_keep_word(Domain* domain, size_t word, uint64_t keep);
+
+/**
+ * Remove the values of a Domain structure which do not satisfy a constraint,
+ * the other variables of the constraint keeping their values. The domain check
+ * function of the constraint is preferred to its check function when it has
+ * one.
+ * @param domain The Domain structure of the variable.
+ * @param constraint The constraint to satisfy.
+ * @param values The values of the variables.
+ * @param data The data to pass to the check functions.
+ * @param variable The variable of the domain.
+ * @return true if values were removed, false otherwise.
+ * @post values[variable] is unspecified.
+ */
+extern bool domain_filter(Domain* domain, const CSPConstraint* constraint,
+	size_t* values, const void* data, size_t variable
+);
+
+/**
+ * Sort the values left of a Domain structure by increasing key, values of
+ * equal keys keeping their order.
+ * @param domain The Domain structure.
+ * @param keys The key of each value, indexed by value.
+ */
+extern void domain_sort(Domain* domain, const size_t* keys);
+
+/**
+ * Restore the values of a Domain structure removed since it had the
+ * specified amount of values.
+ * @param domain The Domain structure.
+ * @param amount The amount of values to restore up to.
+ * @pre The values were removed in a last in first out order since then.
+ */
+extern void domain_restore(Domain* domain, size_t amount);
+
 /**
  * Print the values in a Domain structure.
  * @param domain The Domain structure to print.
@@ -200,8 +301,8 @@ extern void domain_change_stack_restore(const DomainChange* stack,
  * @param stack The DomainChange structure.
  * @param stack_top Pointer to the top of the stack.
  * @param domain_index The index of the domain that changed.
- * @param value The value that was removed from the domain.
+ * @param amount The amount of values of the domain before the change.
  */
 extern void domain_change_stack_add(DomainChange* stack, size_t* stack_top,
-	size_t domain_index, size_t value
+	size_t domain_index, size_t amount
 );
@@ -0,0 +1,43 @@
+/**
+ * @file bits.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Get the index of the lowest bit set in a word.
+ * @param bits The word.
+ * @return The index of the lowest bit set.
+ * @pre bits != 0
+ */
+static inline size_t bits_ctz(uint64_t bits){
+#ifdef __GNUC__
+	return (size_t) __builtin_ctzll(bits);
+#else
+	size_t index = 0;
+	for(; !(bits & 1); bits >>= 1) index++;
+	return index;
+#endif
+}
+
+/**
+ * Get the index of the highest bit set in a word.
+ * @param bits The word.
+ * @return The index of the highest bit set.
+ * @pre bits != 0
+ */
+static inline size_t bits_highest(uint64_t bits){
+#ifdef __GNUC__
+	return 63 - (size_t) __builtin_clzll(bits);
+#else
+	size_t index = 63;
+	for(; !(bits & (UINT64_C(1) << 63)); bits <<= 1) index--;
+	return index;
+#endif
+}
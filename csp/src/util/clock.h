@@ -0,0 +1,20 @@
+/**
+ * @file clock.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#pragma once
+
+#include <time.h>
+
+/**
+ * Get the time of a monotonic clock.
+ * @return The time in seconds.
+ */
+static inline double clock_now(void){
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double) now.tv_sec + (double) now.tv_nsec / 1e9;
+}
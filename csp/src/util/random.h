@@ -0,0 +1,36 @@
+/**
+ * @file random.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Get the next number of a xorshift64* generator.
+ * @param state The state of the generator, not 0.
+ * @return The next number.
+ */
+static inline uint64_t random_next(uint64_t *state){
+	uint64_t x = *state;
+	x ^= x >> 12;
+	x ^= x << 25;
+	x ^= x >> 27;
+	*state = x;
+	return x * UINT64_C(0x2545F4914F6CDD1D);
+}
+
+/**
+ * Get a number lower than a bound.
+ * @param state The state of the generator, not 0.
+ * @param bound The bound.
+ * @return A number in [0, bound).
+ * @pre bound > 0
+ */
+static inline size_t random_below(uint64_t *state, size_t bound){
+	return (size_t) ((random_next(state) >> 11) % bound);
+}
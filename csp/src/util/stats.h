@@ -0,0 +1,34 @@
+/**
+ * @file stats.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef CSP_STATS
+	/**
+	 * @brief The counters of the work done outside of a solver by the thread.
+	 * @var checks The number of calls to check functions.
+	 * @var pruned The number of values removed from domains.
+	 */
+	typedef struct {
+		uint64_t checks;
+		uint64_t pruned;
+	} StatsCounters;
+
+	/**
+	 * The counters of the thread, a solve running on a single thread.
+	 */
+	extern _Thread_local StatsCounters stats_counters;
+
+	/**
+	 * Run a statement collecting statistics, compiled out without CSP_STATS.
+	 */
+	#define STATS(statement) do { statement; } while (0)
+#else
+	#define STATS(statement) do {} while (0)
+#endif
@@ -0,0 +1,115 @@
+/**
+ * @file constraint-builtins.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "csp.h"
+
+#define TEST_CORE_CONSTRAINT_BUILTINS_WORDS 3
+#define TEST_CORE_CONSTRAINT_BUILTINS_VALUES 200
+
+// Check the domain check function of a constraint against its check function,
+// for the values of a variable and a slice of words starting at base
+static void test_core_constraint_builtins__agree(const CSPConstraint *constraint,
+	size_t variable, size_t base
+){
+	CSPChecker *check = csp_constraint_get_check(constraint);
+	CSPDomainChecker *domain_check = csp_constraint_get_domain_check(
+		constraint
+	);
+	size_t other = csp_constraint_get_variable(constraint, 0) == variable
+		? csp_constraint_get_variable(constraint, 1)
+		: csp_constraint_get_variable(constraint, 0);
+	size_t values[2];
+	uint64_t words[TEST_CORE_CONSTRAINT_BUILTINS_WORDS];
+	uint64_t keep[TEST_CORE_CONSTRAINT_BUILTINS_WORDS];
+
+	// Every other value of the slice is in the set
+	for(size_t i = 0; i < TEST_CORE_CONSTRAINT_BUILTINS_WORDS; i++){
+		words[i] = UINT64_C(0x5555555555555555) << i % 2;
+	}
+
+	for(size_t v = 0; v < TEST_CORE_CONSTRAINT_BUILTINS_VALUES; v++){
+		values[other] = v;
+		domain_check(constraint, values, NULL, variable, base, words,
+			TEST_CORE_CONSTRAINT_BUILTINS_WORDS, keep
+		);
+
+		for(size_t b = 0; b < TEST_CORE_CONSTRAINT_BUILTINS_WORDS * 64; b++){
+			bool in = words[b / 64] >> b % 64 & 1;
+			bool kept = keep[b / 64] >> b % 64 & 1;
+
+			values[variable] = base + b;
+			assert(kept == (in && check(constraint, values, NULL)));
+		}
+	}
+}
+
+int test_core_constraint_builtins(void){
+	const size_t bases[] = {0, 64, 128};
+	const size_t bases_count = sizeof(bases) / sizeof(size_t);
+
+	// Initialise the library
+	csp_init();
+	{
+		CSPConstraint *constraints[] = {
+			csp_constraint_create_not_equal(0, 1),
+			csp_constraint_create_not_difference(0, 1, 70),
+			csp_constraint_create_not_difference(1, 0, -3),
+			csp_constraint_create_queens(0, 1),
+			csp_constraint_create_queens(1, 0),
+			csp_constraint_create_less(0, 1),
+			csp_constraint_create_less_equal(1, 0)
+		};
+		const size_t constraints_count = sizeof(constraints)
+			/ sizeof(CSPConstraint*);
+
+		// The check functions
+		size_t values[2] = {5, 5};
+		assert(!csp_constraint_get_check(constraints[0])(constraints[0], values,
+			NULL
+		));
+		assert(csp_constraint_get_check(constraints[5])(constraints[5],
+			(size_t[]) {4, 5}, NULL
+		));
+		assert(!csp_constraint_get_check(constraints[5])(constraints[5], values,
+			NULL
+		));
+		assert(csp_constraint_get_check(constraints[6])(constraints[6], values,
+			NULL
+		));
+		assert(!csp_constraint_get_check(constraints[1])(constraints[1],
+			(size_t[]) {75, 5}, NULL
+		));
+		assert(!csp_constraint_get_check(constraints[3])(constraints[3],
+			(size_t[]) {3, 4}, NULL
+		));
+
+		// The domain check functions agree with them on every value
+		for(size_t i = 0; i < constraints_count; i++){
+			assert(constraints[i] != NULL);
+			assert(csp_constraint_get_arity(constraints[i]) == 2);
+
+			for(size_t b = 0; b < bases_count; b++){
+				test_core_constraint_builtins__agree(constraints[i], 0, bases[b]);
+				test_core_constraint_builtins__agree(constraints[i], 1, bases[b]);
+			}
+			csp_constraint_destroy(constraints[i]);
+		}
+	}
+	// Finish the library
+	csp_finish();
+
+	return EXIT_SUCCESS;
+}
@@ -10,6 +10,7 @@
 #endif
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <assert.h>
 
@@ -25,6 +26,19 @@ bool test_core_constraint__dummy_check(
 	return true;
 }
 
+// Dummy domain check function
+void test_core_constraint__dummy_domain_check(
+	const CSPConstraint *UNUSED_VAR(constraint),
+	const size_t *UNUSED_VAR(values),
+	const void *UNUSED_VAR(data),
+	size_t UNUSED_VAR(variable), size_t UNUSED_VAR(base),
+	const uint64_t *words, size_t num_words, uint64_t *keep
+){
+	for(size_t i = 0; i < num_words; i++){
+		keep[i] = words[i];
+	}
+}
+
 int test_core_constraint(void){
 	CSPChecker *dummy_check = &test_core_constraint__dummy_check;
 
@@ -47,6 +61,15 @@ int test_core_constraint(void){
 		// Check the function
 		assert(csp_constraint_get_check(constraint) == dummy_check);
 
+		// Check the domain function, none until one is set
+		assert(csp_constraint_get_domain_check(constraint) == NULL);
+		csp_constraint_set_domain_check(constraint,
+			test_core_constraint__dummy_domain_check
+		);
+		assert(csp_constraint_get_domain_check(constraint)
+			== test_core_constraint__dummy_domain_check
+		);
+
 		// Destroy the constraint
 		csp_constraint_destroy(constraint);
 	}
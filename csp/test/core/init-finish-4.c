@@ -0,0 +1,55 @@
+/**
+ * @file init-finish-4.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <pthread.h>
+
+#include "csp.h"
+#include "util/unused.h"
+
+#define TEST_CORE_INIT_FINISH_4__THREADS 8
+#define TEST_CORE_INIT_FINISH_4__ROUNDS 1000
+
+// Initialise and finish the library many times
+static void *test_core_init_finish_4__run(void *UNUSED_VAR(arg)){
+	for(size_t i = 0; i < TEST_CORE_INIT_FINISH_4__ROUNDS; i++){
+		assert(csp_init());
+		assert(csp_initialised());
+		assert(csp_finish());
+	}
+
+	return NULL;
+}
+
+int test_core_init_finish_4(void){
+	pthread_t threads[TEST_CORE_INIT_FINISH_4__THREADS];
+
+	// The library stays initialised while the threads run
+	assert(csp_init());
+	for(size_t i = 0; i < TEST_CORE_INIT_FINISH_4__THREADS; i++){
+		assert(pthread_create(&threads[i], NULL, test_core_init_finish_4__run,
+			NULL
+		) == 0);
+	}
+	for(size_t i = 0; i < TEST_CORE_INIT_FINISH_4__THREADS; i++){
+		assert(pthread_join(threads[i], NULL) == 0);
+	}
+	assert(csp_initialised());
+
+	// Every initialisation was finished
+	assert(csp_finish());
+	assert(!csp_initialised());
+	assert(csp_finish() == false);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,113 @@
+/**
+ * @file problem-finalise.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "csp.h"
+#include "util/unused.h"
+
+// Dummy check function
+bool test_core_problem_finalise__dummy_check(
+	const CSPConstraint *UNUSED_VAR(constraint),
+	const size_t *UNUSED_VAR(values),
+	const void *UNUSED_VAR(data)
+){
+	return true;
+}
+
+int test_core_problem_finalise(void){
+	CSPChecker *dummy_check = &test_core_problem_finalise__dummy_check;
+
+	// Initialise the library
+	csp_init();
+	{
+		// Create the problem: X0 - X1, X1 - X2, X0 - X0 and X3
+		CSPProblem *problem = csp_problem_create(4, 4);
+		assert(problem != NULL);
+
+		size_t scopes[4][2] = {{0, 1}, {1, 2}, {0, 0}, {3, 3}};
+		CSPConstraint *constraints[4];
+		for(size_t index = 0; index < 4; index++){
+			constraints[index] = csp_constraint_create(index == 3 ? 1 : 2,
+				dummy_check
+			);
+			for(size_t k = 0; k < csp_constraint_get_arity(constraints[index]);
+				k++
+			){
+				csp_constraint_set_variable(constraints[index], k,
+					scopes[index][k]
+				);
+			}
+			csp_problem_set_constraint(problem, index, constraints[index]);
+		}
+
+		// Check the problem is finalised correctly
+		assert(!csp_problem_is_finalised(problem));
+		assert(csp_problem_finalise(problem));
+		assert(csp_problem_is_finalised(problem));
+
+		size_t amount;
+		CSPConstraint *const *variable_constraints;
+
+		variable_constraints = csp_problem_get_variable_constraints(problem, 0,
+			&amount
+		);
+		assert(amount == 2);
+		assert(variable_constraints[0] == constraints[0]);
+		assert(variable_constraints[1] == constraints[2]);
+
+		const size_t *ids = csp_problem_get_variable_constraint_ids(problem, 0,
+			&amount
+		);
+		assert(amount == 2);
+		assert(ids[0] == 0);
+		assert(ids[1] == 2);
+
+		variable_constraints = csp_problem_get_variable_constraints(problem, 1,
+			&amount
+		);
+		assert(amount == 2);
+		assert(variable_constraints[0] == constraints[0]);
+		assert(variable_constraints[1] == constraints[1]);
+
+		variable_constraints = csp_problem_get_variable_constraints(problem, 2,
+			&amount
+		);
+		assert(amount == 1);
+		assert(variable_constraints[0] == constraints[1]);
+
+		ids = csp_problem_get_variable_constraint_ids(problem, 2, &amount);
+		assert(amount == 1);
+		assert(ids[0] == 1);
+
+		variable_constraints = csp_problem_get_variable_constraints(problem, 3,
+			&amount
+		);
+		assert(amount == 1);
+		assert(variable_constraints[0] == constraints[3]);
+
+		// Setting a constraint discards the index
+		csp_problem_set_constraint(problem, 3, constraints[3]);
+		assert(!csp_problem_is_finalised(problem));
+
+		// Destroy the problem
+		for(size_t index = 0; index < 4; index++){
+			csp_constraint_destroy(constraints[index]);
+		}
+		csp_problem_destroy(problem);
+	}
+	// Finish the library
+	csp_finish();
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,186 @@
+/**
+ * @file batch.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "csp.h"
+#include "test-utils.h"
+
+#define TEST_SOLVER_BATCH_ROWS 6
+#define TEST_SOLVER_BATCH_ROUNDS 50
+#define TEST_SOLVER_BATCH_MAX 8
+
+// Place the queen of the constraint on the row given as data
+bool test_solver_batch__row(const CSPConstraint *constraint,
+	const size_t *values, const void *data
+){
+	return values[csp_constraint_get_variable(constraint, 0)]
+		== *(const size_t *) data;
+}
+
+// Create the n queens, the first one placed on the row given as data if fixed
+static CSPProblem *test_solver_batch__create(size_t n, bool fixed){
+	CSPProblem *problem = test_solver_utils__pairwise(n, n, fixed,
+		test_solver_utils__queens
+	);
+
+	if(fixed){
+		CSPConstraint *constraint = csp_constraint_create(1,
+			test_solver_batch__row
+		);
+		assert(constraint != NULL);
+
+		csp_constraint_set_variable(constraint, 0, 0);
+		csp_problem_set_constraint(problem, n * (n - 1) / 2, constraint);
+	}
+	assert(csp_problem_finalise(problem));
+
+	return problem;
+}
+
+int test_solver_batch(void){
+	const SolveType solve_types[] = {
+		0, FC | OVARS_MIN, MAC | OVARS_DOMWDEG, FC | CBJ
+	};
+	const size_t solve_types_count = sizeof(solve_types) / sizeof(SolveType);
+	const size_t threads[] = {1, 2, 4, 8};
+	const size_t threads_count = sizeof(threads) / sizeof(size_t);
+
+	// Initialise the library
+	csp_init();
+	{
+		// One model solved with the data of many instances
+		const size_t count = TEST_SOLVER_BATCH_ROWS * TEST_SOLVER_BATCH_ROUNDS;
+		CSPProblem *model = test_solver_batch__create(TEST_SOLVER_BATCH_ROWS,
+			true
+		);
+		size_t rows[TEST_SOLVER_BATCH_ROWS];
+		size_t *queens = malloc(count * TEST_SOLVER_BATCH_MAX * sizeof(size_t));
+		CSPBatchInstance *instances = malloc(count * sizeof(CSPBatchInstance));
+		SolveOutcome *outcomes = malloc(count * sizeof(SolveOutcome));
+		assert(queens != NULL && instances != NULL && outcomes != NULL);
+
+		for(size_t i = 0; i < TEST_SOLVER_BATCH_ROWS; i++){
+			rows[i] = i;
+		}
+		for(size_t i = 0; i < count; i++){
+			instances[i] = (CSPBatchInstance) {
+				.csp = model,
+				.data = &rows[i % TEST_SOLVER_BATCH_ROWS],
+				.values = &queens[i * TEST_SOLVER_BATCH_MAX]
+			};
+		}
+
+		for(size_t t = 0; t < solve_types_count; t++){
+			// The nodes of the instances solved one after the other
+			uint64_t nodes = 0;
+			for(size_t i = 0; i < TEST_SOLVER_BATCH_ROWS; i++){
+				CSPSolveStats stats;
+				csp_problem_solve(model, queens, &rows[i], solve_types[t], NULL,
+					NULL, &stats
+				);
+				nodes += stats.nodes;
+			}
+			nodes *= TEST_SOLVER_BATCH_ROUNDS;
+
+			for(size_t k = 0; k < threads_count; k++){
+				CSPSolveStats stats;
+				assert(csp_problem_solve_batch(instances, count, solve_types[t],
+					NULL, threads[k], outcomes, &stats
+				));
+				assert(stats.nodes == nodes);
+
+				// The first queen of the 6 queens is never on a side
+				for(size_t i = 0; i < count; i++){
+					size_t row = i % TEST_SOLVER_BATCH_ROWS;
+					const size_t *solution = instances[i].values;
+					if(row == 0 || row == TEST_SOLVER_BATCH_ROWS - 1){
+						assert(outcomes[i] == OUTCOME_UNSAT);
+						continue;
+					}
+					assert(outcomes[i] == OUTCOME_SAT);
+					assert(solution[0] == row);
+					assert(test_solver_utils__valid_queens(TEST_SOLVER_BATCH_ROWS,
+						solution
+					));
+				}
+			}
+		}
+		test_solver_utils__destroy(model);
+
+		// Problems of several shapes, the threads rebinding their solvers
+		CSPProblem *problems[] = {
+			test_solver_batch__create(8, false),
+			test_solver_batch__create(3, false),
+			test_solver_batch__create(8, false),
+			test_solver_batch__create(5, false),
+			test_solver_batch__create(2, false),
+			test_solver_batch__create(7, false),
+			test_solver_batch__create(8, false)
+		};
+		const size_t problems_count = sizeof(problems) / sizeof(CSPProblem*);
+		const size_t sizes[] = {8, 3, 8, 5, 2, 7, 8};
+		for(size_t i = 0; i < count; i++){
+			instances[i] = (CSPBatchInstance) {
+				.csp = problems[i % problems_count],
+				.data = NULL,
+				.values = &queens[i * TEST_SOLVER_BATCH_MAX]
+			};
+		}
+
+		for(size_t k = 0; k < threads_count; k++){
+			assert(csp_problem_solve_batch(instances, count, FC | OVARS_MIN,
+				NULL, threads[k], outcomes, NULL
+			));
+			for(size_t i = 0; i < count; i++){
+				size_t n = sizes[i % problems_count];
+				if(n < 4){
+					assert(outcomes[i] == OUTCOME_UNSAT);
+				}else{
+					assert(outcomes[i] == OUTCOME_SAT);
+					assert(test_solver_utils__valid_queens(n,
+						instances[i].values
+					));
+				}
+			}
+		}
+
+		// The limits apply to each instance
+		CSPSolveLimits limits = {.nodes = 1};
+		assert(csp_problem_solve_batch(instances, problems_count, 0, &limits, 4,
+			outcomes, NULL
+		));
+		for(size_t i = 0; i < problems_count; i++){
+			assert(sizes[i] < 4 ? outcomes[i] != OUTCOME_SAT
+				: outcomes[i] == OUTCOME_UNKNOWN
+			);
+		}
+
+		// An empty batch has nothing to solve
+		assert(csp_problem_solve_batch(instances, 0, FC, NULL, 4, outcomes,
+			NULL
+		));
+
+		for(size_t i = 0; i < problems_count; i++){
+			test_solver_utils__destroy(problems[i]);
+		}
+		free(outcomes);
+		free(instances);
+		free(queens);
+	}
+	// Finish the library
+	csp_finish();
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,88 @@
+/**
+ * @file cbj.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "csp.h"
+#include "util/unused.h"
+
+// Difference check function
+bool test_solver_cbj__different(const CSPConstraint *constraint,
+	const size_t *values, const void *UNUSED_VAR(data)
+){
+	return values[csp_constraint_get_variable(constraint, 0)]
+		!= values[csp_constraint_get_variable(constraint, 1)];
+}
+
+int test_solver_cbj(void){
+	// The first and two last variables can not be coloured with 2 colours, and
+	// the free variables between them have 3 values each
+	const size_t n = 11;
+	const size_t triangle[3][2] = {{0, 9}, {0, 10}, {9, 10}};
+
+	// Initialise the library
+	csp_init();
+	{
+		CSPProblem *problem = csp_problem_create(n, 3);
+		assert(problem != NULL);
+
+		for(size_t i = 0; i < n; i++){
+			csp_problem_set_domain(problem, i, i == 0 || i >= 9 ? 2 : 3);
+		}
+		for(size_t i = 0; i < 3; i++){
+			CSPConstraint *constraint = csp_constraint_create(2,
+				test_solver_cbj__different
+			);
+			assert(constraint != NULL);
+
+			csp_constraint_set_variable(constraint, 0, triangle[i][0]);
+			csp_constraint_set_variable(constraint, 1, triangle[i][1]);
+			csp_problem_set_constraint(problem, i, constraint);
+		}
+		assert(csp_problem_finalise(problem));
+
+		size_t values[11];
+		CSPSolveStats stats;
+		CSPSolveStats backjump_stats;
+
+		// Chronological backtracking tries every value of the free variables
+		assert(!csp_problem_solve(problem, values, NULL, FC, NULL, NULL,
+			&stats
+		));
+		assert(stats.nodes > 6561);
+
+		// Backjumping goes straight back to the first variable
+		assert(!csp_problem_solve(problem, values, NULL, FC | CBJ, NULL, NULL,
+			&backjump_stats
+		));
+		assert(backjump_stats.nodes <= 2 * n);
+
+		// Even when the refuted decisions are recorded by restarts
+		CSPSolver *solver = csp_solver_create(problem);
+		assert(solver != NULL);
+		csp_solver_set_restarts(solver, RESTARTS_LUBY, 1, 0.0);
+		assert(!csp_solver_solve(solver, values, NULL, FC | CBJ, NULL, NULL,
+			NULL
+		));
+		csp_solver_destroy(solver);
+
+		for(size_t i = 0; i < csp_problem_get_num_constraints(problem); i++){
+			csp_constraint_destroy(csp_problem_get_constraint(problem, i));
+		}
+		csp_problem_destroy(problem);
+	}
+	// Finish the library
+	csp_finish();
+
+	return EXIT_SUCCESS;
+}
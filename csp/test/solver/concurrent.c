@@ -0,0 +1,101 @@
+/**
+ * @file concurrent.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <pthread.h>
+
+#include "csp.h"
+#include "test-utils.h"
+
+/**
+ * @brief A solve of a thread.
+ * @var problem The CSP problem to solve.
+ * @var solve_type The type of solving to use.
+ * @var result Whether the CSP problem was solved.
+ * @var stats The statistics of the solve.
+ */
+typedef struct {
+	const CSPProblem *problem;
+	SolveType solve_type;
+	bool result;
+	CSPSolveStats stats;
+} TestSolverConcurrentSolve;
+
+static void *test_solver_concurrent__run(void *arg){
+	TestSolverConcurrentSolve *solve = arg;
+	size_t values[10];
+
+	solve->result = csp_problem_solve(solve->problem, values, NULL,
+		solve->solve_type, NULL, NULL, &solve->stats
+	);
+
+	return NULL;
+}
+
+int test_solver_concurrent(void){
+	const SolveType solve_types[] = {
+		0, FC, FC | OVARS_MIN, FC | OVARS_MIN | CBJ, MAC | OVARS_DOMWDEG,
+		FC | OVALS
+	};
+	const size_t solve_types_count = sizeof(solve_types) / sizeof(SolveType);
+
+	// Initialise the library
+	csp_init();
+	{
+		// The queens and the pigeons share the library
+		CSPProblem *problems[2] = {
+			test_solver_utils__create_queens(10),
+			test_solver_utils__create(8, 7, test_solver_utils__not_equal)
+		};
+		TestSolverConcurrentSolve solves[2 * 6];
+		pthread_t threads[2 * 6];
+
+		for(size_t p = 0; p < 2; p++){
+			for(size_t t = 0; t < solve_types_count; t++){
+				solves[p * solve_types_count + t] = (TestSolverConcurrentSolve){
+					problems[p], solve_types[t], false, {0}
+				};
+			}
+		}
+		for(size_t i = 0; i < 2 * solve_types_count; i++){
+			assert(pthread_create(&threads[i], NULL, test_solver_concurrent__run,
+				&solves[i]
+			) == 0);
+		}
+		for(size_t i = 0; i < 2 * solve_types_count; i++){
+			assert(pthread_join(threads[i], NULL) == 0);
+		}
+
+		// Each solve counts its own work, as if it were alone
+		for(size_t i = 0; i < 2 * solve_types_count; i++){
+			size_t values[10];
+			CSPSolveStats stats;
+			bool result = csp_problem_solve(solves[i].problem, values, NULL,
+				solves[i].solve_type, NULL, NULL, &stats
+			);
+
+			assert(solves[i].result == result);
+			assert(solves[i].result == (i < solve_types_count));
+			assert(solves[i].stats.nodes == stats.nodes);
+			assert(solves[i].stats.checks == stats.checks);
+			assert(solves[i].stats.pruned == stats.pruned);
+		}
+
+		test_solver_utils__destroy(problems[0]);
+		test_solver_utils__destroy(problems[1]);
+	}
+	// Finish the library
+	csp_finish();
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file deep.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "csp.h"
+#include "util/unused.h"
+
+#define TEST_SOLVER_DEEP_SIZE 5000
+
+// Difference check function
+bool test_solver_deep__diff(const CSPConstraint *constraint,
+	const size_t *values, const void *UNUSED_VAR(data)
+){
+	return values[csp_constraint_get_variable(constraint, 0)]
+		!= values[csp_constraint_get_variable(constraint, 1)];
+}
+
+int test_solver_deep(void){
+	const SolveType solve_types[] = {0, FC, FC | OVARS_MIN};
+	const size_t n = TEST_SOLVER_DEEP_SIZE;
+
+	// Initialise the library
+	csp_init();
+	{
+		// A chain of variables, each different from the next one
+		CSPProblem *problem = csp_problem_create(n, n - 1);
+		assert(problem != NULL);
+
+		for(size_t i = 0; i < n; i++){
+			csp_problem_set_domain(problem, i, 2);
+		}
+		for(size_t i = 0; i < n - 1; i++){
+			CSPConstraint *constraint = csp_constraint_create(2,
+				test_solver_deep__diff
+			);
+			csp_constraint_set_variable(constraint, 0, i);
+			csp_constraint_set_variable(constraint, 1, i + 1);
+			csp_problem_set_constraint(problem, i, constraint);
+		}
+		assert(csp_problem_finalise(problem));
+
+		size_t *values = malloc(n * sizeof(size_t));
+		assert(values != NULL);
+
+		// The search goes as deep as the number of variables
+		for(size_t t = 0; t < sizeof(solve_types) / sizeof(SolveType); t++){
+			CSPSolveStats stats;
+
+			assert(csp_problem_solve(problem, values, NULL, solve_types[t], NULL,
+				NULL, &stats
+			));
+			assert(stats.nodes == n + 1);
+			for(size_t i = 0; i < n - 1; i++){
+				assert(values[i] != values[i + 1]);
+			}
+		}
+
+		free(values);
+
+		for(size_t i = 0; i < n - 1; i++){
+			csp_constraint_destroy(csp_problem_get_constraint(problem, i));
+		}
+		csp_problem_destroy(problem);
+	}
+	// Finish the library
+	csp_finish();
+
+	return EXIT_SUCCESS;
+}
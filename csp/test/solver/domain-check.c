@@ -0,0 +1,165 @@
+/**
+ * @file domain-check.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "csp.h"
+#include "test-utils.h"
+#include "util/unused.h"
+
+#define TEST_SOLVER_DOMAIN_CHECK_QUEENS 8
+#define TEST_SOLVER_DOMAIN_CHECK_SOLUTIONS 92
+#define TEST_SOLVER_DOMAIN_CHECK_SIZE 1500
+#define TEST_SOLVER_DOMAIN_CHECK_SHIFT 7
+
+// Remove a value from a set of the domain check functions if it is in it
+static void test_solver_domain_check__remove(uint64_t *keep, size_t base,
+	size_t num_words, size_t value
+){
+	if(value >= base && value - base < num_words * 64){
+		keep[(value - base) / 64] &= ~((uint64_t) 1 << (value - base) % 64);
+	}
+}
+
+// Queens compatibility domain check function, removing the attacked rows
+void test_solver_domain_check__queens_domain(const CSPConstraint *constraint,
+	const size_t *values, const void *UNUSED_VAR(data), size_t variable,
+	size_t base, const uint64_t *words, size_t num_words, uint64_t *keep
+){
+	size_t x0 = csp_constraint_get_variable(constraint, 0);
+	size_t other = x0 == variable ? csp_constraint_get_variable(constraint, 1)
+		: x0;
+	size_t distance = other > variable ? other - variable : variable - other;
+
+	for(size_t i = 0; i < num_words; i++){
+		keep[i] = words[i];
+	}
+	test_solver_domain_check__remove(keep, base, num_words, values[other]);
+	test_solver_domain_check__remove(keep, base, num_words,
+		values[other] + distance
+	);
+	if(values[other] >= distance){
+		test_solver_domain_check__remove(keep, base, num_words,
+			values[other] - distance
+		);
+	}
+}
+
+// Shift check function, the second variable being the first one shifted
+bool test_solver_domain_check__shift(const CSPConstraint *constraint,
+	const size_t *values, const void *UNUSED_VAR(data)
+){
+	return values[csp_constraint_get_variable(constraint, 0)]
+		+ TEST_SOLVER_DOMAIN_CHECK_SHIFT
+		== values[csp_constraint_get_variable(constraint, 1)];
+}
+
+// Shift domain check function, keeping the single value shifted from the other
+void test_solver_domain_check__shift_domain(const CSPConstraint *constraint,
+	const size_t *values, const void *UNUSED_VAR(data), size_t variable,
+	size_t base, const uint64_t *words, size_t num_words, uint64_t *keep
+){
+	size_t x0 = csp_constraint_get_variable(constraint, 0);
+	size_t x1 = csp_constraint_get_variable(constraint, 1);
+	size_t value = variable == x1
+		? values[x0] + TEST_SOLVER_DOMAIN_CHECK_SHIFT
+		: values[x1] - TEST_SOLVER_DOMAIN_CHECK_SHIFT;
+	bool shifted = variable == x1
+		|| values[x1] >= TEST_SOLVER_DOMAIN_CHECK_SHIFT;
+
+	for(size_t i = 0; i < num_words; i++){
+		keep[i] = 0;
+	}
+	if(shifted && value >= base && value - base < num_words * 64){
+		keep[(value - base) / 64] = words[(value - base) / 64]
+			& (uint64_t) 1 << (value - base) % 64;
+	}
+}
+
+// Create the constraint of a pair of queens, with its domain check function
+static CSPConstraint *test_solver_domain_check__queens(size_t x, size_t y){
+	CSPConstraint *constraint = test_solver_utils__queens(x, y);
+	if(constraint != NULL){
+		csp_constraint_set_domain_check(constraint,
+			test_solver_domain_check__queens_domain
+		);
+	}
+	return constraint;
+}
+
+int test_solver_domain_check(void){
+	const SolveType solve_types[] = {
+		FC, FC | OVARS_MIN, FC | CBJ, MAC, MAC | OVARS_DOMWDEG
+	};
+	const size_t solve_types_count = sizeof(solve_types) / sizeof(SolveType);
+
+	// Initialise the library
+	csp_init();
+	{
+		// The queens are filtered the same way with a call by domain
+		CSPProblem *plain = test_solver_utils__create(
+			TEST_SOLVER_DOMAIN_CHECK_QUEENS, TEST_SOLVER_DOMAIN_CHECK_QUEENS,
+			test_solver_utils__queens
+		);
+		CSPProblem *domain = test_solver_utils__create(
+			TEST_SOLVER_DOMAIN_CHECK_QUEENS, TEST_SOLVER_DOMAIN_CHECK_QUEENS,
+			test_solver_domain_check__queens
+		);
+
+		for(size_t t = 0; t < solve_types_count; t++){
+			CSPSolveStats plain_stats, domain_stats;
+			assert(csp_problem_count_solutions(plain, NULL, solve_types[t],
+				&plain_stats
+			) == TEST_SOLVER_DOMAIN_CHECK_SOLUTIONS);
+			assert(csp_problem_count_solutions(domain, NULL, solve_types[t],
+				&domain_stats
+			) == TEST_SOLVER_DOMAIN_CHECK_SOLUTIONS);
+
+			// The values being removed in another order, only the number of
+			// calls to the check functions is compared
+#ifdef CSP_STATS
+			assert(domain_stats.checks < plain_stats.checks);
+#endif
+		}
+		test_solver_utils__destroy(domain);
+		test_solver_utils__destroy(plain);
+
+		// A domain larger than a slice of words is checked slice by slice
+		CSPProblem *problem = csp_problem_create(2, 1);
+		CSPConstraint *constraint = csp_constraint_create(2,
+			test_solver_domain_check__shift
+		);
+		assert(problem != NULL && constraint != NULL);
+		csp_problem_set_domain(problem, 0, TEST_SOLVER_DOMAIN_CHECK_SIZE);
+		csp_problem_set_domain(problem, 1, TEST_SOLVER_DOMAIN_CHECK_SIZE);
+		csp_constraint_set_variable(constraint, 0, 0);
+		csp_constraint_set_variable(constraint, 1, 1);
+		csp_constraint_set_domain_check(constraint,
+			test_solver_domain_check__shift_domain
+		);
+		csp_problem_set_constraint(problem, 0, constraint);
+		assert(csp_problem_finalise(problem));
+
+		for(size_t t = 0; t < solve_types_count; t++){
+			assert(csp_problem_count_solutions(problem, NULL, solve_types[t], NULL)
+				== TEST_SOLVER_DOMAIN_CHECK_SIZE - TEST_SOLVER_DOMAIN_CHECK_SHIFT
+			);
+		}
+		test_solver_utils__destroy(problem);
+	}
+	// Finish the library
+	csp_finish();
+
+	return EXIT_SUCCESS;
+}
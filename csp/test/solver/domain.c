@@ -0,0 +1,94 @@
+/**
+ * @file domain.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "csp.h"
+
+int test_solver_domain(void){
+	// Initialise the library
+	csp_init();
+	{
+		// A domain spanning several words
+		Domain *domain = domain_create(130);
+		assert(domain != NULL);
+		assert(domain->amount == 130);
+		assert(domain->num_words == 3);
+		assert(domain->size == 130);
+		assert(domain_contains(domain, 0));
+		assert(domain_contains(domain, 129));
+		assert(!domain_contains(domain, 130));
+		assert(domain_next(domain, 64) == 64);
+		assert(domain_next(domain, 130) == SIZE_MAX);
+
+		DomainChange *stack = domain_change_stack_create(130);
+		size_t stack_top = 0;
+		assert(stack != NULL);
+
+		// Keep the even values of the second word
+		domain_change_stack_add(stack, &stack_top, 0, domain->amount);
+		domain_keep_word(domain, 1, UINT64_C(0x5555555555555555));
+		assert(domain->amount == 98);
+		assert(!domain_contains(domain, 65));
+		assert(domain_next(domain, 65) == 66);
+
+		// Remove a value, the values left stay first
+		size_t stop_point = stack_top;
+		domain_change_stack_add(stack, &stack_top, 0, domain->amount);
+		domain_remove(domain, 0);
+		assert(domain->amount == 97);
+		assert(!domain_contains(domain, 0));
+		assert(domain->values[97] == 0);
+		for(size_t i = 0; i < domain->amount; i++){
+			assert(domain_contains(domain, domain->values[i]));
+			assert(domain->positions[domain->values[i]] == i);
+		}
+
+		// Restore the changes in reverse order
+		domain_change_stack_restore(stack, &stack_top, &stop_point, &domain);
+		assert(stack_top == 1);
+		assert(domain->amount == 98);
+		assert(domain_contains(domain, 0));
+
+		stop_point = 0;
+		domain_change_stack_restore(stack, &stack_top, &stop_point, &domain);
+		assert(domain->amount == 130);
+		assert(domain_contains(domain, 65));
+		for(size_t i = 0; i < domain->amount; i++){
+			assert(domain->positions[domain->values[i]] == i);
+		}
+
+		// Reset to a smaller size
+		domain_reset(domain, 3);
+		assert(domain->amount == 3);
+		assert(domain_next(domain, 3) == SIZE_MAX);
+
+		// Sort the values left by key, equal keys keeping their order
+		const size_t keys[] = {2, 1, 1};
+		domain_sort(domain, keys);
+		assert(domain->values[0] == 1);
+		assert(domain->values[1] == 2);
+		assert(domain->values[2] == 0);
+		for(size_t i = 0; i < domain->amount; i++){
+			assert(domain->positions[domain->values[i]] == i);
+		}
+
+		domain_change_stack_destroy(stack);
+		domain_destroy(domain);
+	}
+	// Finish the library
+	csp_finish();
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,119 @@
+/**
+ * @file enumerate.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "csp.h"
+#include "test-utils.h"
+
+/**
+ * @brief The solutions received by the callback.
+ * @var n The number of queens.
+ * @var solutions The solutions, n values each.
+ * @var count The number of solutions.
+ * @var stop The number of solutions after which to stop.
+ */
+typedef struct {
+	size_t n;
+	size_t solutions[4 * 6];
+	size_t count;
+	size_t stop;
+} TestSolverEnumerateSeen;
+
+// Keep each solution, which must be valid and new
+static bool test_solver_enumerate__receive(const size_t *values, void *arg){
+	TestSolverEnumerateSeen *seen = arg;
+
+	for(size_t i = 0; i < seen->n; i++){
+		for(size_t j = i + 1; j < seen->n; j++){
+			assert(values[i] != values[j]);
+			assert(values[i] + j != values[j] + i);
+			assert(values[i] + i != values[j] + j);
+		}
+	}
+	for(size_t k = 0; k < seen->count; k++){
+		assert(memcmp(&seen->solutions[k * seen->n], values,
+			seen->n * sizeof(size_t)
+		) != 0);
+	}
+
+	memcpy(&seen->solutions[seen->count++ * seen->n], values,
+		seen->n * sizeof(size_t)
+	);
+	return seen->count < seen->stop;
+}
+
+int test_solver_enumerate(void){
+	const SolveType solve_types[] = {
+		0, FC, FC | OVARS_MIN, MAC, MAC | OVALS_SUPPORTS, FC | OVALS, FC | CBJ,
+		MAC | CBJ, CBJ, FC | OVARS_DOMWDEG | CBJ
+	};
+	const size_t solve_types_count = sizeof(solve_types) / sizeof(SolveType);
+	const uint64_t counts[] = {1, 0, 0, 2, 10, 4, 40, 92};
+
+	// Initialise the library
+	csp_init();
+	{
+		// The numbers of solutions of the n queens
+		for(size_t t = 0; t < solve_types_count; t++){
+			for(size_t n = 2; n <= 8; n++){
+				CSPProblem *problem = test_solver_utils__create_queens(n);
+				assert(csp_problem_count_solutions(problem, NULL, solve_types[t],
+					NULL
+				) == counts[n - 1]);
+				test_solver_utils__destroy(problem);
+			}
+		}
+
+		// The callback receives every solution, and can stop the enumeration
+		CSPProblem *problem = test_solver_utils__create_queens(6);
+		CSPSolver *solver = csp_solver_create(problem);
+		TestSolverEnumerateSeen seen = {.n = 6, .stop = SIZE_MAX};
+		size_t queens[6];
+		assert(solver != NULL);
+
+		assert(csp_solver_enumerate(solver, queens, NULL, FC | CBJ, NULL, NULL,
+			test_solver_enumerate__receive, &seen, NULL
+		) == 4);
+		assert(seen.count == 4);
+		assert(csp_solver_get_outcome(solver) == OUTCOME_SAT);
+
+		seen = (TestSolverEnumerateSeen) {.n = 6, .stop = 3};
+		assert(csp_solver_enumerate(solver, queens, NULL, MAC, NULL, NULL,
+			test_solver_enumerate__receive, &seen, NULL
+		) == 3);
+		assert(seen.count == 3);
+
+		// A limit leaves the count incomplete
+		CSPSolveLimits limits = {.nodes = 10};
+		csp_solver_set_limits(solver, &limits);
+		assert(csp_solver_enumerate(solver, queens, NULL, FC, NULL, NULL, NULL,
+			NULL, NULL
+		) < 4);
+		assert(csp_solver_get_outcome(solver) == OUTCOME_UNKNOWN);
+
+		// The solver still solves once the enumeration is over
+		csp_solver_set_limits(solver, NULL);
+		assert(csp_solver_solve(solver, queens, NULL, FC, NULL, NULL, NULL));
+		assert(csp_solver_get_outcome(solver) == OUTCOME_SAT);
+
+		csp_solver_destroy(solver);
+		test_solver_utils__destroy(problem);
+	}
+	// Finish the library
+	csp_finish();
+
+	return EXIT_SUCCESS;
+}
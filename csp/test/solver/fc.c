@@ -0,0 +1,190 @@
+/**
+ * @file fc.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "csp.h"
+#include "test-utils.h"
+#include "util/unused.h"
+
+#define TEST_SOLVER_FC_VARIABLES 6
+#define TEST_SOLVER_FC_DOMAIN 5
+
+// Sum check function, the last variable being the sum of the others
+bool test_solver_fc__sum(const CSPConstraint *constraint,
+	const size_t *values, const void *UNUSED_VAR(data)
+){
+	size_t arity = csp_constraint_get_arity(constraint);
+	size_t sum = 0;
+
+	for(size_t i = 0; i + 1 < arity; i++){
+		sum += values[csp_constraint_get_variable(constraint, i)];
+	}
+	return sum == values[csp_constraint_get_variable(constraint, arity - 1)];
+}
+
+// Difference check function
+bool test_solver_fc__different(const CSPConstraint *constraint,
+	const size_t *values, const void *UNUSED_VAR(data)
+){
+	return values[csp_constraint_get_variable(constraint, 0)]
+		!= values[csp_constraint_get_variable(constraint, 1)];
+}
+
+static CSPProblem *test_solver_fc__create(const size_t (*scopes)[3],
+	const size_t *arities, CSPChecker *const *checks, size_t num_constraints
+){
+	CSPProblem *problem = csp_problem_create(TEST_SOLVER_FC_VARIABLES,
+		num_constraints
+	);
+	assert(problem != NULL);
+
+	for(size_t i = 0; i < TEST_SOLVER_FC_VARIABLES; i++){
+		csp_problem_set_domain(problem, i, TEST_SOLVER_FC_DOMAIN);
+	}
+	for(size_t i = 0; i < num_constraints; i++){
+		CSPConstraint *constraint = csp_constraint_create(arities[i], checks[i]);
+		assert(constraint != NULL);
+
+		for(size_t j = 0; j < arities[i]; j++){
+			csp_constraint_set_variable(constraint, j, scopes[i][j]);
+		}
+		csp_problem_set_constraint(problem, i, constraint);
+	}
+	assert(csp_problem_finalise(problem));
+
+	return problem;
+}
+
+// Count the solutions of the CSP problem by trying every assignment
+static uint64_t test_solver_fc__brute_force(const CSPProblem *problem){
+	size_t values[TEST_SOLVER_FC_VARIABLES] = {0};
+	uint64_t count = 0;
+
+	while(true){
+		bool valid = true;
+		for(size_t i = 0; valid && i < csp_problem_get_num_constraints(problem);
+			i++
+		){
+			const CSPConstraint *constraint = csp_problem_get_constraint(problem,
+				i
+			);
+			valid = csp_constraint_get_check(constraint)(constraint, values, NULL);
+		}
+		count += valid;
+
+		size_t i = 0;
+		while(i < TEST_SOLVER_FC_VARIABLES
+			&& ++values[i] == TEST_SOLVER_FC_DOMAIN
+		){
+			values[i++] = 0;
+		}
+		if(i == TEST_SOLVER_FC_VARIABLES){
+			return count;
+		}
+	}
+}
+
+int test_solver_fc(void){
+	const SolveType solve_types[] = {
+		0, FC, FC | OVARS_MIN, FC | OVARS_MAX, FC | CBJ, FC | OVARS_MIN | CBJ,
+		FC | OVARS_MAX | CBJ, FC | OVARS_DOMWDEG | CBJ
+	};
+	const size_t solve_types_count = sizeof(solve_types) / sizeof(SolveType);
+
+	// Initialise the library
+	csp_init();
+	{
+		// Ternary sums mixed with binary differences
+		const size_t scopes[][3] = {
+			{0, 1, 2}, {2, 3, 4}, {1, 5}, {3, 5}, {0, 4}, {1, 3, 5}
+		};
+		const size_t arities[] = {3, 3, 2, 2, 2, 3};
+		CSPChecker *const checks[] = {
+			test_solver_fc__sum, test_solver_fc__sum, test_solver_fc__different,
+			test_solver_fc__different, test_solver_fc__different,
+			test_solver_fc__sum
+		};
+		const size_t constraints_count = sizeof(arities) / sizeof(size_t);
+
+		for(size_t c = 1; c <= constraints_count; c++){
+			CSPProblem *problem = test_solver_fc__create(scopes, arities, checks,
+				c
+			);
+			uint64_t expected = test_solver_fc__brute_force(problem);
+
+			for(size_t t = 0; t < solve_types_count; t++){
+				assert(csp_problem_count_solutions(problem, NULL, solve_types[t],
+					NULL
+				) == expected);
+			}
+			test_solver_utils__destroy(problem);
+		}
+
+		// Only the domains of the neighbours of the variable are filtered
+		CSPProblem *problem = test_solver_fc__create(scopes, arities, checks,
+			constraints_count
+		);
+		size_t values[TEST_SOLVER_FC_VARIABLES] = {0};
+		FilledVariables *fv = filled_variables_create(TEST_SOLVER_FC_VARIABLES);
+		Domain *domains[TEST_SOLVER_FC_VARIABLES];
+		DomainChange *change_stack = domain_change_stack_create(
+			TEST_SOLVER_FC_VARIABLES * TEST_SOLVER_FC_DOMAIN
+		);
+		size_t stack_top = 0;
+		assert(fv != NULL && change_stack != NULL);
+		for(size_t i = 0; i < TEST_SOLVER_FC_VARIABLES; i++){
+			domains[i] = domain_create(TEST_SOLVER_FC_DOMAIN);
+			assert(domains[i] != NULL);
+		}
+
+		// The sum of 0 and 1 leaves a single value to 2, the difference of 1
+		// removes one from 5 and the other domains are left untouched
+		values[0] = 1;
+		values[1] = 2;
+		filled_variables_mark_filled(fv, 0);
+		filled_variables_mark_filled(fv, 1);
+		assert(csp_problem_forward_check(problem, values, NULL, 1, fv, NULL,
+			NULL, domains, change_stack, &stack_top, NULL
+		));
+		assert(domains[2]->amount == 1 && domain_contains(domains[2], 3));
+		assert(domains[5]->amount == TEST_SOLVER_FC_DOMAIN - 1
+			&& !domain_contains(domains[5], 2)
+		);
+		assert(domains[3]->amount == TEST_SOLVER_FC_DOMAIN);
+		assert(domains[4]->amount == TEST_SOLVER_FC_DOMAIN);
+
+		// No value of 2 is the sum of 3 and 2
+		values[0] = 3;
+		const size_t bottom = 0;
+		domain_change_stack_restore(change_stack, &stack_top, &bottom, domains);
+		CSPConstraint *wipeout = NULL;
+		assert(!csp_problem_forward_check(problem, values, NULL, 1, fv, NULL,
+			NULL, domains, change_stack, &stack_top, &wipeout
+		));
+		assert(wipeout == csp_problem_get_constraint(problem, 0));
+		assert(domains[2]->amount == TEST_SOLVER_FC_DOMAIN);
+
+		for(size_t i = 0; i < TEST_SOLVER_FC_VARIABLES; i++){
+			domain_destroy(domains[i]);
+		}
+		domain_change_stack_destroy(change_stack);
+		filled_variables_destroy(fv);
+		test_solver_utils__destroy(problem);
+	}
+	// Finish the library
+	csp_finish();
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,117 @@
+/**
+ * @file incremental.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "csp.h"
+#include "test-utils.h"
+
+// Solve the 8 queens under assumptions, which are then retracted
+static void test_solver_incremental__solve(CSPSolver *solver,
+	SolveType solve_type
+){
+	size_t queens[8];
+
+	// The 4 solutions with the first queen on the first row
+	assert(csp_solver_assume(solver, 0, 0));
+	assert(csp_solver_solve(solver, queens, NULL, solve_type, NULL, NULL,
+		NULL
+	));
+	assert(queens[0] == 0);
+	assert(csp_solver_enumerate(solver, queens, NULL, solve_type, NULL, NULL,
+		NULL, NULL, NULL
+	) == 4);
+
+	// Their second queens are on the rows 4, 5 and 6
+	assert(csp_solver_assume_not(solver, 1, 4));
+	assert(csp_solver_assume_not(solver, 1, 5));
+	assert(csp_solver_enumerate(solver, queens, NULL, solve_type, NULL, NULL,
+		NULL, NULL, NULL
+	) == 2);
+	assert(csp_solver_assume_not(solver, 1, 6));
+	assert(!csp_solver_solve(solver, queens, NULL, solve_type, NULL, NULL,
+		NULL
+	));
+	assert(csp_solver_get_outcome(solver) == OUTCOME_UNSAT);
+
+	// Contradicting assumptions wipe a domain out at the root
+	csp_solver_retract(solver);
+	assert(csp_solver_assume(solver, 2, 1));
+	assert(csp_solver_assume(solver, 2, 3));
+	assert(!csp_solver_solve(solver, queens, NULL, solve_type, NULL, NULL,
+		NULL
+	));
+
+	// Once retracted, every solution is back
+	csp_solver_retract(solver);
+	assert(csp_solver_solve(solver, queens, NULL, solve_type, NULL, NULL,
+		NULL
+	));
+	assert(csp_solver_enumerate(solver, queens, NULL, solve_type, NULL, NULL,
+		NULL, NULL, NULL
+	) == 92);
+}
+
+int test_solver_incremental(void){
+	const SolveType solve_types[] = {
+		0, FC, MAC, FC | CBJ, MAC | OVARS_DOMWDEG, FC | OVALS_SUPPORTS
+	};
+	const size_t solve_types_count = sizeof(solve_types) / sizeof(SolveType);
+
+	// Initialise the library
+	csp_init();
+	{
+		CSPProblem *problem = test_solver_utils__create_queens(8);
+		CSPSolver *solver = csp_solver_create(problem);
+		assert(solver != NULL);
+
+		// The assumptions hold whether the root is kept or not
+		for(size_t t = 0; t < solve_types_count; t++){
+			test_solver_incremental__solve(solver, solve_types[t]);
+			csp_solver_set_incremental(solver, true);
+			test_solver_incremental__solve(solver, solve_types[t]);
+			csp_solver_set_incremental(solver, false);
+		}
+
+		// The nogoods learnt under assumptions are forgotten once retracted
+		csp_solver_set_incremental(solver, true);
+		csp_solver_set_restarts(solver, RESTARTS_LUBY, 1, 0.0);
+		size_t queens[8];
+		assert(csp_solver_assume_not(solver, 0, 0));
+		assert(csp_solver_solve(solver, queens, NULL, FC, NULL, NULL, NULL));
+		assert(queens[0] != 0);
+		csp_solver_retract(solver);
+		assert(csp_solver_assume(solver, 0, 0));
+		assert(csp_solver_solve(solver, queens, NULL, FC, NULL, NULL, NULL));
+		assert(queens[0] == 0);
+		csp_solver_retract(solver);
+		csp_solver_set_restarts(solver, RESTARTS_NONE, 0, 0.0);
+
+#ifdef CSP_STATS
+		// The root made arc consistent is not propagated again
+		CSPSolveStats first;
+		CSPSolveStats second;
+		assert(csp_solver_solve(solver, queens, NULL, MAC, NULL, NULL, &first));
+		assert(csp_solver_solve(solver, queens, NULL, MAC, NULL, NULL, &second));
+		assert(second.checks < first.checks);
+#endif
+
+		csp_solver_destroy(solver);
+		test_solver_utils__destroy(problem);
+	}
+	// Finish the library
+	csp_finish();
+
+	return EXIT_SUCCESS;
+}
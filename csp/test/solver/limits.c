@@ -0,0 +1,118 @@
+/**
+ * @file limits.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <time.h>
+#include <assert.h>
+#include <pthread.h>
+
+#include "csp.h"
+#include "test-utils.h"
+
+// Cancel the solve after a while
+static void *test_solver_limits__cancel(void *arg){
+	atomic_bool *cancel = arg;
+	struct timespec delay = {.tv_sec = 0, .tv_nsec = 20000000};
+
+	nanosleep(&delay, NULL);
+	atomic_store(cancel, true);
+
+	return NULL;
+}
+
+int test_solver_limits(void){
+	// Initialise the library
+	csp_init();
+	{
+		size_t values[12];
+		CSPSolveStats stats;
+
+		// Without limits, the outcome tells whether there is a solution
+		CSPProblem *problem = test_solver_utils__create(4, 4,
+			test_solver_utils__not_equal
+		);
+		assert(csp_problem_solve_limited(problem, values, NULL, FC, NULL, NULL,
+			NULL, NULL, NULL
+		) == OUTCOME_SAT);
+		test_solver_utils__destroy(problem);
+
+		problem = test_solver_utils__create(5, 4,
+			test_solver_utils__not_equal
+		);
+		assert(csp_problem_solve_limited(problem, values, NULL, FC, NULL, NULL,
+			NULL, NULL, NULL
+		) == OUTCOME_UNSAT);
+		test_solver_utils__destroy(problem);
+
+		// Proving that 12 pigeons do not fit in 11 holes takes too long
+		problem = test_solver_utils__create(12, 11,
+			test_solver_utils__not_equal
+		);
+		CSPSolver *solver = csp_solver_create(problem);
+		assert(solver != NULL);
+
+		CSPSolveLimits limits = {.nodes = 1000};
+		csp_solver_set_limits(solver, &limits);
+		assert(!csp_solver_solve(solver, values, NULL, FC, NULL, NULL, &stats));
+		assert(csp_solver_get_outcome(solver) == OUTCOME_UNKNOWN);
+		assert(stats.nodes == 1000);
+
+		limits = (CSPSolveLimits) {.trail = 20};
+		csp_solver_set_limits(solver, &limits);
+		assert(!csp_solver_solve(solver, values, NULL, FC, NULL, NULL, &stats));
+		assert(csp_solver_get_outcome(solver) == OUTCOME_UNKNOWN);
+		assert(stats.max_depth < 12);
+
+		limits = (CSPSolveLimits) {.time = 0.02};
+		csp_solver_set_limits(solver, &limits);
+		assert(!csp_solver_solve(solver, values, NULL, FC, NULL, NULL, &stats));
+		assert(csp_solver_get_outcome(solver) == OUTCOME_UNKNOWN);
+
+		// A cancelled solve stops before its first decision
+		atomic_bool cancel;
+		atomic_init(&cancel, true);
+		csp_solver_set_limits(solver, NULL);
+		csp_solver_set_cancel(solver, &cancel);
+		assert(!csp_solver_solve(solver, values, NULL, FC, NULL, NULL, &stats));
+		assert(csp_solver_get_outcome(solver) == OUTCOME_UNKNOWN);
+		assert(stats.nodes == 1);
+
+		// Another thread can cancel the solve
+		pthread_t thread;
+		atomic_store(&cancel, false);
+		assert(pthread_create(&thread, NULL, test_solver_limits__cancel,
+			&cancel
+		) == 0);
+		assert(!csp_solver_solve(solver, values, NULL, FC, NULL, NULL, NULL));
+		assert(csp_solver_get_outcome(solver) == OUTCOME_UNKNOWN);
+		pthread_join(thread, NULL);
+
+		csp_solver_destroy(solver);
+		test_solver_utils__destroy(problem);
+
+		// The solves within the limits keep their outcome
+		problem = test_solver_utils__create(10, 10,
+			test_solver_utils__not_equal
+		);
+		limits = (CSPSolveLimits) {.time = 60.0, .nodes = 1000, .trail = 1000};
+		assert(csp_problem_solve_limited(problem, values, NULL, FC, NULL, NULL,
+			&limits, NULL, &stats
+		) == OUTCOME_SAT);
+		assert(stats.nodes == 11);
+		test_solver_utils__destroy(problem);
+	}
+	// Finish the library
+	csp_finish();
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,126 @@
+/**
+ * @file mac.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "csp.h"
+#include "test-utils.h"
+#include "util/unused.h"
+
+// Ordering check function
+bool test_solver_mac__less(const CSPConstraint *constraint,
+	const size_t *values, const void *UNUSED_VAR(data)
+){
+	return values[csp_constraint_get_variable(constraint, 0)]
+		< values[csp_constraint_get_variable(constraint, 1)];
+}
+
+// Sum check function, the sum being given by the data
+bool test_solver_mac__sum(const CSPConstraint *constraint,
+	const size_t *values, const void *data
+){
+	size_t sum = 0;
+	for(size_t k = 0; k < csp_constraint_get_arity(constraint); k++){
+		sum += values[csp_constraint_get_variable(constraint, k)];
+	}
+	return sum == *(const size_t *) data;
+}
+
+static CSPConstraint *test_solver_mac__constraint(CSPProblem *problem,
+	size_t index, CSPChecker *check, size_t arity, const size_t *vars
+){
+	CSPConstraint *constraint = csp_constraint_create(arity, check);
+	assert(constraint != NULL);
+
+	for(size_t k = 0; k < arity; k++){
+		csp_constraint_set_variable(constraint, k, vars[k]);
+	}
+	csp_problem_set_constraint(problem, index, constraint);
+
+	return constraint;
+}
+
+int test_solver_mac(void){
+	// Initialise the library
+	csp_init();
+	{
+		// MAC visits at most the nodes of FC, the constraints only having a
+		// check function
+		const size_t n = 12;
+		CSPProblem *problem = test_solver_utils__create(n, n,
+			test_solver_utils__queens
+		);
+
+		size_t queens[12];
+		CSPSolveStats fc_stats;
+		CSPSolveStats mac_stats;
+		assert(csp_problem_solve(problem, queens, NULL, FC, NULL, NULL,
+			&fc_stats
+		));
+		assert(csp_problem_solve(problem, queens, NULL, MAC, NULL, NULL,
+			&mac_stats
+		));
+		assert(mac_stats.nodes <= fc_stats.nodes);
+		assert(test_solver_utils__valid_queens(n, queens));
+
+		test_solver_utils__destroy(problem);
+	}
+	{
+		// A chain of orderings is solved without backtracking
+		CSPProblem *problem = csp_problem_create(4, 4);
+		assert(problem != NULL);
+
+		for(size_t i = 0; i < 4; i++){
+			csp_problem_set_domain(problem, i, 4);
+		}
+		for(size_t i = 0; i < 3; i++){
+			const size_t vars[] = {i, i + 1};
+			test_solver_mac__constraint(problem, i, test_solver_mac__less, 2, vars);
+		}
+
+		// And a ternary sum, revised once two of its variables are filled
+		const size_t vars[] = {0, 2, 3};
+		test_solver_mac__constraint(problem, 3, test_solver_mac__sum, 3, vars);
+		assert(csp_problem_finalise(problem));
+
+		size_t values[4];
+		CSPSolveStats stats;
+		size_t sum = 5;
+		assert(csp_problem_solve(problem, values, &sum, MAC, NULL, NULL,
+			&stats
+		));
+		for(size_t i = 0; i < 4; i++){
+			assert(values[i] == i);
+		}
+		assert(stats.nodes == 5);
+
+		// The sum can only be checked once the orderings are decided
+		sum = 6;
+		assert(!csp_problem_solve(problem, values, &sum, MAC, NULL, NULL,
+			NULL
+		));
+
+		// The orderings wipe a domain out before the first decision
+		csp_problem_set_domain(problem, 3, 3);
+		assert(!csp_problem_solve(problem, values, &sum, MAC, NULL, NULL,
+			&stats
+		));
+		assert(stats.nodes == 0);
+
+		test_solver_utils__destroy(problem);
+	}
+	// Finish the library
+	csp_finish();
+
+	return EXIT_SUCCESS;
+}
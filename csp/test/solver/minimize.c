@@ -0,0 +1,166 @@
+/**
+ * @file minimize.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "csp.h"
+#include "test-utils.h"
+#include "util/unused.h"
+
+#define TEST_SOLVER_MINIMIZE_N 8
+
+/**
+ * @brief The best objective of the solutions seen.
+ * @var best The best objective.
+ * @var improvements The number of improving solutions received.
+ */
+typedef struct {
+	double best;
+	size_t improvements;
+} TestSolverMinimizeSeen;
+
+// Weight the row of each queen by its column
+static double test_solver_minimize__objective(const size_t *values,
+	const void *UNUSED_VAR(data)
+){
+	double cost = 0.0;
+	for(size_t i = 0; i < TEST_SOLVER_MINIMIZE_N; i++){
+		cost += (double) ((i + 1) * values[i]);
+	}
+	return cost;
+}
+
+// Weight the smallest row left of each queen not placed yet
+static double test_solver_minimize__bound(const size_t *values,
+	const FilledVariables *fv, Domain *const *domains,
+	const void *UNUSED_VAR(data)
+){
+	double cost = 0.0;
+	for(size_t i = 0; i < TEST_SOLVER_MINIMIZE_N; i++){
+		size_t row = values[i];
+		if(!filled_variables_is_filled(fv, i)){
+			row = SIZE_MAX;
+			for(size_t k = 0; k < domains[i]->amount; k++){
+				if(domains[i]->values[k] < row){
+					row = domains[i]->values[k];
+				}
+			}
+		}
+		cost += (double) ((i + 1) * row);
+	}
+	return cost;
+}
+
+// Find the best objective by enumerating every solution
+static bool test_solver_minimize__enumerate(const size_t *values, void *arg){
+	double *best = arg;
+	double cost = test_solver_minimize__objective(values, NULL);
+	if(cost < *best){
+		*best = cost;
+	}
+	return true;
+}
+
+// Verify that each improving solution is better than the previous one
+static bool test_solver_minimize__improve(const size_t *values, void *arg){
+	TestSolverMinimizeSeen *seen = arg;
+	double cost = test_solver_minimize__objective(values, NULL);
+
+	assert(cost < seen->best);
+	seen->best = cost;
+	seen->improvements++;
+	return true;
+}
+
+// Stop at the first solution
+static bool test_solver_minimize__first(const size_t *UNUSED_VAR(values),
+	void *UNUSED_VAR(arg)
+){
+	return false;
+}
+
+int test_solver_minimize(void){
+	const SolveType solve_types[] = {
+		0, FC, FC | OVARS_MIN, MAC, FC | CBJ, MAC | CBJ, FC | OVARS_DOMWDEG
+	};
+	const size_t solve_types_count = sizeof(solve_types) / sizeof(SolveType);
+
+	// Initialise the library
+	csp_init();
+	{
+		CSPProblem *problem = test_solver_utils__create_queens(
+			TEST_SOLVER_MINIMIZE_N
+		);
+		CSPSolver *solver = csp_solver_create(problem);
+		size_t queens[TEST_SOLVER_MINIMIZE_N];
+		CSPSolveStats stats;
+		double optimum = INFINITY;
+		assert(solver != NULL);
+
+		assert(csp_solver_enumerate(solver, queens, NULL, FC, NULL, NULL,
+			test_solver_minimize__enumerate, &optimum, &stats
+		) == 92);
+		uint64_t nodes = stats.nodes;
+
+		// Every type of solving finds the optimum, the bound pruning subtrees
+		for(size_t t = 0; t < solve_types_count; t++){
+			TestSolverMinimizeSeen seen = {.best = INFINITY};
+			double cost;
+
+			assert(csp_solver_minimize(solver, queens, NULL, solve_types[t], NULL,
+				NULL, test_solver_minimize__objective, NULL,
+				test_solver_minimize__improve, &seen, &cost, NULL
+			));
+			assert(cost == optimum && seen.best == optimum);
+			assert(test_solver_minimize__objective(queens, NULL) == optimum);
+			assert(csp_solver_get_outcome(solver) == OUTCOME_SAT);
+
+			seen = (TestSolverMinimizeSeen) {.best = INFINITY};
+			assert(csp_solver_minimize(solver, queens, NULL, solve_types[t], NULL,
+				NULL, test_solver_minimize__objective, test_solver_minimize__bound,
+				test_solver_minimize__improve, &seen, &cost, &stats
+			));
+			assert(cost == optimum && seen.best == optimum);
+			assert(test_solver_minimize__objective(queens, NULL) == optimum);
+			assert(csp_solver_get_outcome(solver) == OUTCOME_SAT);
+			if(solve_types[t] == FC){
+				assert(stats.nodes < nodes);
+			}
+		}
+
+		// A stopped minimization keeps its best solution without proving it
+		double cost;
+		assert(csp_solver_minimize(solver, queens, NULL, FC, NULL, NULL,
+			test_solver_minimize__objective, NULL, test_solver_minimize__first,
+			NULL, &cost, NULL
+		));
+		assert(test_solver_minimize__objective(queens, NULL) == cost);
+		assert(csp_solver_get_outcome(solver) == OUTCOME_UNKNOWN);
+
+		csp_solver_destroy(solver);
+		test_solver_utils__destroy(problem);
+
+		// Without solutions there is nothing to minimize
+		problem = test_solver_utils__create_queens(3);
+		assert(!csp_problem_minimize(problem, queens, NULL, FC, NULL, NULL,
+			test_solver_minimize__objective, NULL, NULL, NULL, NULL, NULL
+		));
+		test_solver_utils__destroy(problem);
+	}
+	// Finish the library
+	csp_finish();
+
+	return EXIT_SUCCESS;
+}
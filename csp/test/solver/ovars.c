@@ -0,0 +1,160 @@
+/**
+ * @file ovars.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "csp.h"
+#include "test-utils.h"
+#include "util/unused.h"
+
+// Always satisfied check function
+bool test_solver_ovars__any(const CSPConstraint *UNUSED_VAR(constraint),
+	const size_t *UNUSED_VAR(values), const void *UNUSED_VAR(data)
+){
+	return true;
+}
+
+// Equality check function
+bool test_solver_ovars__equal(const CSPConstraint *constraint,
+	const size_t *values, const void *UNUSED_VAR(data)
+){
+	return values[csp_constraint_get_variable(constraint, 0)]
+		== values[csp_constraint_get_variable(constraint, 1)];
+}
+
+// Order check function
+bool test_solver_ovars__less(const CSPConstraint *constraint,
+	const size_t *values, const void *UNUSED_VAR(data)
+){
+	return values[csp_constraint_get_variable(constraint, 0)]
+		< values[csp_constraint_get_variable(constraint, 1)];
+}
+
+static CSPProblem *test_solver_ovars__create(const size_t *domains,
+	size_t num_domains, const size_t (*pairs)[2], CSPChecker *const *checks,
+	size_t num_constraints
+){
+	CSPProblem *problem = csp_problem_create(num_domains, num_constraints);
+	assert(problem != NULL);
+
+	for(size_t i = 0; i < num_domains; i++){
+		csp_problem_set_domain(problem, i, domains[i]);
+	}
+	for(size_t i = 0; i < num_constraints; i++){
+		CSPConstraint *constraint = csp_constraint_create(2, checks[i]);
+		assert(constraint != NULL);
+
+		csp_constraint_set_variable(constraint, 0, pairs[i][0]);
+		csp_constraint_set_variable(constraint, 1, pairs[i][1]);
+		csp_problem_set_constraint(problem, i, constraint);
+	}
+	assert(csp_problem_finalise(problem));
+
+	return problem;
+}
+
+// Solve the CSP problem, keeping the assignments of the search in order
+static size_t test_solver_ovars__assignments(CSPSolver *solver,
+	SolveType solve_type, CSPTraceBuffer *buffer, size_t *variables
+){
+	size_t values[8];
+	size_t count = 0;
+
+	csp_trace_buffer_clear(buffer);
+	assert(csp_solver_solve(solver, values, NULL, solve_type, NULL, NULL,
+		NULL
+	));
+	for(size_t i = 0; i < csp_trace_buffer_get_count(buffer); i++){
+		const CSPTraceEvent *event = csp_trace_buffer_get_event(buffer, i);
+		if(event->type == TRACE_ASSIGN){
+			variables[count++] = event->variable;
+		}
+	}
+	return count;
+}
+
+int test_solver_ovars(void){
+	const uint64_t seeds[] = {0, 1, 42};
+	const size_t seeds_count = sizeof(seeds) / sizeof(uint64_t);
+
+	// Initialise the library
+	csp_init();
+	{
+		CSPTraceBuffer *buffer = csp_trace_buffer_create(64);
+		size_t variables[64];
+		assert(buffer != NULL);
+
+		// Domains of distinct sizes, which no constraint reduces
+		const size_t sizes[] = {5, 3, 4, 1, 2};
+		const size_t any[][2] = {{0, 1}};
+		CSPChecker *const anys[] = {test_solver_ovars__any};
+		CSPProblem *problem = test_solver_ovars__create(sizes, 5, any, anys, 1);
+		CSPSolver *solver = csp_solver_create(problem);
+		assert(solver != NULL);
+		csp_solver_set_trace(solver, csp_trace_buffer_record, buffer);
+
+		for(size_t s = 0; s < seeds_count; s++){
+			const size_t smallest[] = {3, 4, 1, 2, 0};
+			const size_t largest[] = {0, 2, 1, 4, 3};
+			csp_solver_set_seed(solver, seeds[s]);
+
+			assert(test_solver_ovars__assignments(solver, FC | OVARS_MIN, buffer,
+				variables
+			) == 5);
+			for(size_t i = 0; i < 5; i++){
+				assert(variables[i] == smallest[i]);
+			}
+
+			assert(test_solver_ovars__assignments(solver, FC | OVARS_MAX, buffer,
+				variables
+			) == 5);
+			for(size_t i = 0; i < 5; i++){
+				assert(variables[i] == largest[i]);
+			}
+		}
+		csp_solver_destroy(solver);
+		test_solver_utils__destroy(problem);
+
+		// Domains reduced by forward checking and restored on failure
+		const size_t domains[] = {4, 4, 4, 3};
+		const size_t pairs[][2] = {{0, 1}, {2, 3}};
+		CSPChecker *const checks[] = {
+			test_solver_ovars__equal, test_solver_ovars__less
+		};
+		problem = test_solver_ovars__create(domains, 4, pairs, checks, 2);
+		solver = csp_solver_create(problem);
+		assert(solver != NULL);
+		csp_solver_set_trace(solver, csp_trace_buffer_record, buffer);
+
+		for(size_t s = 0; s < seeds_count; s++){
+			csp_solver_set_seed(solver, seeds[s]);
+
+			// The smallest domain fails first, then leaves a single value to the
+			// variable below it, the equal variables coming last in any order
+			assert(test_solver_ovars__assignments(solver, FC | OVARS_MIN, buffer,
+				variables
+			) == 5);
+			assert(variables[0] == 3 && variables[1] == 3 && variables[2] == 2);
+			assert(variables[3] + variables[4] == 1);
+		}
+		csp_solver_destroy(solver);
+		test_solver_utils__destroy(problem);
+
+		csp_trace_buffer_destroy(buffer);
+	}
+	// Finish the library
+	csp_finish();
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,161 @@
+/**
+ * @file parallel.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "csp.h"
+#include "test-utils.h"
+
+#define TEST_SOLVER_PARALLEL_QUEENS 9
+#define TEST_SOLVER_PARALLEL_SOLUTIONS 352
+#define TEST_SOLVER_PARALLEL_STOP 10
+
+/**
+ * @brief The solutions received by the callback.
+ * @var count The number of solutions.
+ * @var stop The number of solutions after which to stop.
+ */
+typedef struct {
+	uint64_t count;
+	uint64_t stop;
+} TestSolverParallelSeen;
+
+// Count each solution, which must be valid, the threads calling one at a time
+static bool test_solver_parallel__receive(const size_t *values, void *arg){
+	TestSolverParallelSeen *seen = arg;
+
+	assert(test_solver_utils__valid_queens(TEST_SOLVER_PARALLEL_QUEENS,
+		values
+	));
+	return ++seen->count < seen->stop;
+}
+
+int test_solver_parallel(void){
+	const SolveType solve_types[] = {
+		0, FC | OVARS_MIN, FC | OVARS_MIN | CBJ, MAC | OVARS_DOMWDEG,
+		FC | OVARS_MIN | OVALS
+	};
+	const size_t solve_types_count = sizeof(solve_types) / sizeof(SolveType);
+
+	// Initialise the library
+	csp_init();
+	{
+		// Queens are solved whatever the number of threads
+		CSPProblem *problem = test_solver_utils__create_queens(12);
+
+		size_t queens[12];
+		CSPSolveStats stats;
+		for(size_t t = 0; t < solve_types_count; t++){
+			for(size_t threads = 1; threads <= 4; threads *= 2){
+				assert(csp_problem_solve_parallel(problem, queens, NULL,
+					solve_types[t], threads, &stats
+				));
+				assert(stats.nodes > 0);
+				assert(test_solver_utils__valid_queens(12, queens));
+			}
+		}
+
+		test_solver_utils__destroy(problem);
+	}
+	{
+		// Every subtree is searched before proving 7 pigeons need 7 holes
+		CSPProblem *problem = test_solver_utils__create(7, 6,
+			test_solver_utils__not_equal
+		);
+
+		size_t pigeons[7];
+		CSPSolveStats stats;
+		CSPSolveStats parallel_stats;
+		for(size_t t = 0; t < solve_types_count; t++){
+			assert(!csp_problem_solve(problem, pigeons, NULL, solve_types[t],
+				NULL, NULL, &stats
+			));
+			assert(!csp_problem_solve_parallel(problem, pigeons, NULL,
+				solve_types[t], 4, &parallel_stats
+			));
+			assert(stats.nodes > 0 && parallel_stats.nodes > 0);
+		}
+
+		test_solver_utils__destroy(problem);
+	}
+	{
+		// Every solution is counted once whatever the number of threads
+		CSPProblem *problem = test_solver_utils__create_queens(
+			TEST_SOLVER_PARALLEL_QUEENS
+		);
+
+		CSPSolveStats stats;
+		for(size_t t = 0; t < solve_types_count; t++){
+			for(size_t threads = 1; threads <= 4; threads *= 2){
+				assert(csp_problem_count_solutions_parallel(problem, NULL,
+					solve_types[t], threads, &stats
+				) == TEST_SOLVER_PARALLEL_SOLUTIONS);
+				assert(stats.nodes > 0);
+
+				TestSolverParallelSeen seen = {0, UINT64_MAX};
+				assert(csp_problem_enumerate_parallel(problem, NULL,
+					solve_types[t], threads, test_solver_parallel__receive, &seen,
+					NULL
+				) == TEST_SOLVER_PARALLEL_SOLUTIONS);
+				assert(seen.count == TEST_SOLVER_PARALLEL_SOLUTIONS);
+
+				// The callback stops every thread
+				seen = (TestSolverParallelSeen) {0, TEST_SOLVER_PARALLEL_STOP};
+				assert(csp_problem_enumerate_parallel(problem, NULL,
+					solve_types[t], threads, test_solver_parallel__receive, &seen,
+					NULL
+				) == TEST_SOLVER_PARALLEL_STOP);
+				assert(seen.count == TEST_SOLVER_PARALLEL_STOP);
+			}
+		}
+
+		test_solver_utils__destroy(problem);
+
+		// Without a dynamic ordering, the threads visit the nodes of a single
+		// thread, each given value being counted once
+		problem = test_solver_utils__create_queens(TEST_SOLVER_PARALLEL_QUEENS);
+
+		const SolveType static_types[] = {0, FC, MAC, MAC | OVALS};
+		for(size_t t = 0; t < sizeof(static_types) / sizeof(SolveType); t++){
+			CSPSolveStats sequential_stats;
+			assert(csp_problem_count_solutions(problem, NULL, static_types[t],
+				&sequential_stats
+			) == TEST_SOLVER_PARALLEL_SOLUTIONS);
+			assert(csp_problem_count_solutions_parallel(problem, NULL,
+				static_types[t], 4, &stats
+			) == TEST_SOLVER_PARALLEL_SOLUTIONS);
+
+			assert(stats.nodes == sequential_stats.nodes);
+#ifdef CSP_STATS
+			assert(stats.decisions == sequential_stats.decisions);
+			assert(stats.backtracks == sequential_stats.backtracks);
+#endif
+		}
+
+		test_solver_utils__destroy(problem);
+
+		// No pigeons fit
+		problem = test_solver_utils__create(7, 6,
+			csp_constraint_create_not_equal
+		);
+		assert(csp_problem_count_solutions_parallel(problem, NULL, FC, 4, NULL)
+			== 0
+		);
+		test_solver_utils__destroy(problem);
+	}
+	// Finish the library
+	csp_finish();
+
+	return EXIT_SUCCESS;
+}
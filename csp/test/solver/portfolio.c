@@ -0,0 +1,65 @@
+/**
+ * @file portfolio.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "csp.h"
+#include "test-utils.h"
+
+int test_solver_portfolio(void){
+	const CSPPortfolioConfig configs[] = {
+		{0, RESTARTS_NONE, 0, 0.0, 0},
+		{FC | OVARS_MIN, RESTARTS_NONE, 0, 0.0, 0},
+		{MAC | OVARS_DOMWDEG, RESTARTS_NONE, 0, 0.0, 0},
+		{FC | OVARS_DOMWDEG, RESTARTS_LUBY, 8, 0.0, 42},
+		{MAC | OVARS_MIN, RESTARTS_GEOMETRIC, 16, 1.5, 7}
+	};
+	const size_t configs_count = sizeof(configs) / sizeof(CSPPortfolioConfig);
+
+	// Initialise the library
+	csp_init();
+	{
+		// The plain backtracking never wins on 40 queens
+		CSPProblem *problem = test_solver_utils__create_queens(40);
+		size_t queens[40];
+		size_t winner = SIZE_MAX;
+		CSPSolveStats stats;
+
+		assert(csp_problem_solve_portfolio(problem, queens, NULL, configs,
+			configs_count, &winner, &stats
+		));
+		assert(0 < winner && winner < configs_count);
+		assert(stats.nodes > 0);
+		assert(test_solver_utils__valid_queens(40, queens));
+
+		test_solver_utils__destroy(problem);
+	}
+	{
+		// A single configuration proves there are no 3 queens
+		CSPProblem *problem = test_solver_utils__create_queens(3);
+		size_t queens[3];
+		size_t winner = SIZE_MAX;
+
+		assert(!csp_problem_solve_portfolio(problem, queens, NULL, configs, 1,
+			&winner, NULL
+		));
+		assert(winner == 0);
+
+		test_solver_utils__destroy(problem);
+	}
+	// Finish the library
+	csp_finish();
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,61 @@
+/**
+ * @file queens.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "csp.h"
+#include "test-utils.h"
+
+int test_solver_queens(void){
+	const SolveType solve_types[] = {
+		0, OVARS_MIN, FC, FC | OVARS_MIN, FC | OVARS_MAX, MAC, MAC | OVARS_MIN,
+		OVALS, FC | OVARS_MIN | OVALS, MAC | OVALS_SUPPORTS, FC | OVARS_DOMWDEG,
+		MAC | OVARS_DOMWDEG, FC | CBJ, FC | OVARS_MIN | CBJ, MAC | CBJ, CBJ
+	};
+	const size_t solve_types_count = sizeof(solve_types) / sizeof(SolveType);
+
+	// Initialise the library
+	csp_init();
+	{
+		for(size_t t = 0; t < solve_types_count; t++){
+			// 8 queens have solutions, the constraints only having a check
+			// function
+			CSPProblem *problem = test_solver_utils__create(8, 8,
+				test_solver_utils__queens
+			);
+			size_t queens[8];
+			CSPSolveStats stats;
+
+			assert(csp_problem_solve(problem, queens, NULL, solve_types[t],
+				NULL, NULL, &stats
+			));
+			assert(test_solver_utils__valid_queens(8, queens));
+			assert(stats.nodes > 0);
+
+			test_solver_utils__destroy(problem);
+
+			// 3 queens do not
+			problem = test_solver_utils__create(3, 3, test_solver_utils__queens);
+
+			assert(!csp_problem_solve(problem, queens, NULL, solve_types[t],
+				NULL, NULL, NULL
+			));
+
+			test_solver_utils__destroy(problem);
+		}
+	}
+	// Finish the library
+	csp_finish();
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,89 @@
+/**
+ * @file restarts.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "csp.h"
+#include "test-utils.h"
+
+int test_solver_restarts(void){
+	const SolveType solve_types[] = {
+		0, FC | OVARS_MIN, MAC | OVARS_DOMWDEG
+	};
+	const size_t solve_types_count = sizeof(solve_types) / sizeof(SolveType);
+
+	// Initialise the library
+	csp_init();
+	{
+		// Queens are solved whatever the restarts
+		CSPProblem *problem = test_solver_utils__create_queens(16);
+		CSPSolver *solver = csp_solver_create(problem);
+		assert(solver != NULL);
+
+		size_t queens[16];
+		for(size_t t = 0; t < solve_types_count; t++){
+			for(uint64_t seed = 0; seed < 4; seed++){
+				csp_solver_set_seed(solver, seed);
+				csp_solver_set_restarts(solver,
+					seed % 2 == 0 ? RESTARTS_LUBY : RESTARTS_GEOMETRIC, 1, 1.5
+				);
+
+				assert(csp_solver_solve(solver, queens, NULL, solve_types[t], NULL,
+					NULL, NULL
+				));
+				assert(test_solver_utils__valid_queens(16, queens));
+			}
+		}
+
+		csp_solver_destroy(solver);
+		test_solver_utils__destroy(problem);
+	}
+	{
+		// The nogoods keep the search complete on 7 pigeons for 6 holes
+		CSPProblem *problem = test_solver_utils__create(7, 6,
+			test_solver_utils__not_equal
+		);
+		CSPSolver *solver = csp_solver_create(problem);
+		assert(solver != NULL);
+
+		size_t pigeons[7];
+		CSPSolveStats stats;
+		for(size_t t = 0; t < solve_types_count; t++){
+			csp_solver_set_seed(solver, 42);
+			csp_solver_set_restarts(solver, RESTARTS_LUBY, 1, 0.0);
+
+			assert(!csp_solver_solve(solver, pigeons, NULL, solve_types[t], NULL,
+				NULL, &stats
+			));
+			assert(csp_solver_get_restarts(solver) > 0);
+			assert(stats.restarts == csp_solver_get_restarts(solver));
+
+			// The same search without restarts
+			uint64_t restarted_nodes = stats.nodes;
+			csp_solver_set_restarts(solver, RESTARTS_NONE, 0, 0.0);
+			assert(!csp_solver_solve(solver, pigeons, NULL, solve_types[t], NULL,
+				NULL, &stats
+			));
+			assert(csp_solver_get_restarts(solver) == 0);
+			assert(restarted_nodes > 0 && stats.nodes > 0);
+		}
+
+		csp_solver_destroy(solver);
+		test_solver_utils__destroy(problem);
+	}
+	// Finish the library
+	csp_finish();
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,155 @@
+/**
+ * @file reuse.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "csp.h"
+#include "test-utils.h"
+#include "util/unused.h"
+
+#include "solver/csp-solver.inc.h"
+
+// Difference check function
+bool test_solver_reuse__diff(const CSPConstraint *constraint,
+	const size_t *values, const void *UNUSED_VAR(data)
+){
+	return values[csp_constraint_get_variable(constraint, 0)]
+		!= values[csp_constraint_get_variable(constraint, 1)];
+}
+
+// Data check function, forbids the value given by data for the variable
+bool test_solver_reuse__data(const CSPConstraint *constraint,
+	const size_t *values, const void *data
+){
+	size_t variable = csp_constraint_get_variable(constraint, 0);
+
+	return values[variable] != ((const size_t *)data)[variable];
+}
+
+// Create a problem where all variables are different from each other
+static CSPProblem *test_solver_reuse__create(size_t n, size_t domain){
+	CSPProblem *problem = csp_problem_create(n, n * (n - 1) / 2 + n);
+	assert(problem != NULL);
+
+	size_t index = 0;
+	for(size_t i = 0; i < n; i++){
+		csp_problem_set_domain(problem, i, domain);
+
+		CSPConstraint *constraint = csp_constraint_create(1,
+			test_solver_reuse__data
+		);
+		csp_constraint_set_variable(constraint, 0, i);
+		csp_problem_set_constraint(problem, index++, constraint);
+
+		for(size_t j = i + 1; j < n; j++){
+			constraint = csp_constraint_create(2, test_solver_reuse__diff);
+			csp_constraint_set_variable(constraint, 0, i);
+			csp_constraint_set_variable(constraint, 1, j);
+			csp_problem_set_constraint(problem, index++, constraint);
+		}
+	}
+	assert(csp_problem_finalise(problem));
+
+	return problem;
+}
+
+int test_solver_reuse(void){
+	// Initialise the library
+	csp_init();
+	{
+		CSPProblem *problem = test_solver_reuse__create(4, 4);
+		CSPProblem *same = test_solver_reuse__create(4, 3);
+		CSPProblem *other = test_solver_reuse__create(5, 5);
+
+		CSPSolver *solver = csp_solver_create(problem);
+		assert(solver != NULL);
+
+		// Solve the same problem many times with different data
+		for(size_t k = 0; k < 100; k++){
+			size_t forbidden[4] = {k % 4, (k + 1) % 4, (k + 2) % 4, (k + 3) % 4};
+			size_t values[4];
+
+			assert(csp_solver_solve(solver, values, forbidden,
+				k % 2 ? FC | OVARS_MIN : 0, NULL, NULL, NULL
+			));
+			for(size_t i = 0; i < 4; i++){
+				assert(values[i] < 4 && values[i] != forbidden[i]);
+				for(size_t j = i + 1; j < 4; j++){
+					assert(values[i] != values[j]);
+				}
+			}
+		}
+
+		// A smaller problem of the same shape fits, and has no solution
+		size_t forbidden[4] = {3, 3, 3, 3};
+		size_t values[4];
+		assert(csp_solver_reset(solver, same));
+		assert(!csp_solver_solve(solver, values, forbidden, FC, NULL, NULL,
+			NULL
+		));
+
+		// A problem of another shape does not fit
+		assert(!csp_solver_reset(solver, other));
+
+		csp_solver_destroy(solver);
+
+		test_solver_utils__destroy(other);
+		test_solver_utils__destroy(same);
+		test_solver_utils__destroy(problem);
+	}
+	{
+		// The arcs and residues of a problem of the same shape fit in the ones
+		// of the previous problem
+		CSPProblem *problem = test_solver_reuse__create(4, 4);
+		CSPProblem *same = test_solver_reuse__create(4, 3);
+
+		size_t forbidden[4] = {0, 1, 2, 3};
+		size_t values[4];
+		CSPSolver *solver = csp_solver_create(problem);
+		assert(solver != NULL);
+		assert(csp_solver_solve(solver, values, forbidden, MAC, NULL, NULL,
+			NULL
+		));
+
+		const size_t *arc_bases = solver->arc_bases;
+		const size_t *arc_mirrors = solver->arc_mirrors;
+		const size_t *residue_offsets = solver->residue_offsets;
+		const size_t *residues = solver->residues;
+		assert(residues != NULL);
+
+		assert(csp_solver_reset(solver, same));
+		assert(!csp_solver_solve(solver, values, forbidden, MAC, NULL, NULL,
+			NULL
+		));
+		assert(solver->arc_bases == arc_bases);
+		assert(solver->arc_mirrors == arc_mirrors);
+		assert(solver->residue_offsets == residue_offsets);
+		assert(solver->residues == residues);
+
+		// The solver goes back to the first problem
+		assert(csp_solver_reset(solver, problem));
+		assert(csp_solver_solve(solver, values, forbidden, MAC, NULL, NULL,
+			NULL
+		));
+		assert(solver->residues == residues);
+
+		csp_solver_destroy(solver);
+
+		test_solver_utils__destroy(same);
+		test_solver_utils__destroy(problem);
+	}
+	// Finish the library
+	csp_finish();
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,59 @@
+/**
+ * @file stats.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "csp.h"
+#include "test-utils.h"
+
+int test_solver_stats(void){
+	const SolveType solve_types[] = {0, FC, MAC, FC | OVARS_MIN | CBJ};
+	const size_t solve_types_count = sizeof(solve_types) / sizeof(SolveType);
+
+	// Initialise the library
+	csp_init();
+	{
+		CSPProblem *problem = test_solver_utils__create_queens(8);
+
+		size_t queens[8];
+		for(size_t t = 0; t < solve_types_count; t++){
+			CSPSolveStats stats;
+			assert(csp_problem_solve(problem, queens, NULL, solve_types[t], NULL,
+				NULL, &stats
+			));
+
+			// The root is a node, every other one is a decision
+			assert(stats.nodes > 8);
+			assert(stats.restarts == 0);
+#ifdef CSP_STATS
+			assert(stats.decisions >= stats.nodes - 1);
+			assert(stats.backtracks <= stats.decisions);
+			assert(stats.checks >= stats.decisions);
+			assert(stats.max_depth == 8);
+			assert((stats.pruned > 0) == (solve_types[t] != 0));
+			assert(stats.wipeouts <= stats.decisions);
+			assert((stats.trail_peak > 0) == (solve_types[t] != 0));
+			assert(stats.preprocess_time >= 0.0 && stats.search_time > 0.0);
+#else
+			assert(stats.decisions == 0 && stats.checks == 0);
+#endif
+		}
+
+		test_solver_utils__destroy(problem);
+	}
+	// Finish the library
+	csp_finish();
+
+	return EXIT_SUCCESS;
+}
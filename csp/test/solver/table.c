@@ -0,0 +1,268 @@
+/**
+ * @file table.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "csp.h"
+#include "test-utils.h"
+
+#define TEST_SOLVER_TABLE_VARIABLES 5
+#define TEST_SOLVER_TABLE_DOMAIN 4
+#define TEST_SOLVER_TABLE_CONSTRAINTS 4
+#define TEST_SOLVER_TABLE_MAX_TUPLES 200
+#define TEST_SOLVER_TABLE_WIDE_DOMAIN 12
+
+/**
+ * @brief A table constraint of the test, built from a predicate.
+ * @var arity The arity of the constraint.
+ * @var variables The variables of the constraint.
+ * @var allowed Whether the tuples satisfying the predicate are allowed or
+ * forbidden.
+ * @var predicate The predicate on the values of the variables.
+ */
+typedef struct {
+	size_t arity;
+	size_t variables[3];
+	bool allowed;
+	bool (*predicate)(const size_t *tuple);
+} TestSolverTableSpec;
+
+// The third value is the sum of the others modulo the domain size
+static bool test_solver_table__sum(const size_t *tuple){
+	return (tuple[0] + tuple[1]) % TEST_SOLVER_TABLE_DOMAIN == tuple[2];
+}
+
+// The values are equal
+static bool test_solver_table__equal(const size_t *tuple){
+	return tuple[0] == tuple[1];
+}
+
+// The values are in increasing order
+static bool test_solver_table__less(const size_t *tuple){
+	return tuple[0] < tuple[1];
+}
+
+// The three values are equal
+static bool test_solver_table__same(const size_t *tuple){
+	return tuple[0] == tuple[1] && tuple[1] == tuple[2];
+}
+
+// Create the table constraint of the tuples satisfying the predicate
+static CSPConstraint *test_solver_table__create(
+	const TestSolverTableSpec *spec, size_t domain
+){
+	size_t tuples[TEST_SOLVER_TABLE_MAX_TUPLES * 3];
+	size_t num_tuples = 0;
+	size_t tuple[3] = {0};
+
+	while(true){
+		if(spec->predicate(tuple)){
+			for(size_t i = 0; i < spec->arity; i++){
+				tuples[num_tuples * spec->arity + i] = tuple[i];
+			}
+			num_tuples++;
+		}
+
+		size_t i = 0;
+		while(i < spec->arity && ++tuple[i] == domain){
+			tuple[i++] = 0;
+		}
+		if(i == spec->arity){
+			break;
+		}
+	}
+
+	CSPConstraint *constraint = csp_constraint_create_table(spec->arity, tuples,
+		num_tuples, spec->allowed
+	);
+	assert(constraint != NULL);
+	for(size_t i = 0; i < spec->arity; i++){
+		csp_constraint_set_variable(constraint, i, spec->variables[i]);
+	}
+	return constraint;
+}
+
+static CSPProblem *test_solver_table__create_problem(
+	const TestSolverTableSpec *specs, size_t num_constraints, size_t num_domains,
+	size_t domain
+){
+	CSPProblem *problem = csp_problem_create(num_domains, num_constraints);
+	assert(problem != NULL);
+
+	for(size_t i = 0; i < num_domains; i++){
+		csp_problem_set_domain(problem, i, domain);
+	}
+	for(size_t i = 0; i < num_constraints; i++){
+		csp_problem_set_constraint(problem, i,
+			test_solver_table__create(&specs[i], domain)
+		);
+	}
+	assert(csp_problem_finalise(problem));
+
+	return problem;
+}
+
+// Count the assignments satisfying the predicates of the constraints
+static uint64_t test_solver_table__brute_force(
+	const TestSolverTableSpec *specs, size_t num_constraints, size_t domain
+){
+	size_t values[TEST_SOLVER_TABLE_VARIABLES] = {0};
+	uint64_t count = 0;
+
+	while(true){
+		bool valid = true;
+		for(size_t c = 0; valid && c < num_constraints; c++){
+			size_t tuple[3];
+			for(size_t i = 0; i < specs[c].arity; i++){
+				tuple[i] = values[specs[c].variables[i]];
+			}
+			valid = specs[c].predicate(tuple) == specs[c].allowed;
+		}
+		count += valid;
+
+		size_t i = 0;
+		while(i < TEST_SOLVER_TABLE_VARIABLES && ++values[i] == domain){
+			values[i++] = 0;
+		}
+		if(i == TEST_SOLVER_TABLE_VARIABLES){
+			return count;
+		}
+	}
+}
+
+int test_solver_table(void){
+	const SolveType solve_types[] = {
+		0, FC, FC | OVARS_MIN, FC | CBJ, MAC, MAC | OVARS_MIN,
+		MAC | OVARS_DOMWDEG
+	};
+	const size_t solve_types_count = sizeof(solve_types) / sizeof(SolveType);
+
+	// Initialise the library
+	csp_init();
+	{
+		// Allowed and forbidden tables of two and three variables
+		const TestSolverTableSpec specs[TEST_SOLVER_TABLE_CONSTRAINTS] = {
+			{3, {0, 1, 2}, true, test_solver_table__sum},
+			{2, {3, 4}, false, test_solver_table__equal},
+			{2, {1, 3}, true, test_solver_table__less},
+			{3, {0, 2, 4}, false, test_solver_table__same}
+		};
+
+		for(size_t c = 1; c <= TEST_SOLVER_TABLE_CONSTRAINTS; c++){
+			CSPProblem *problem = test_solver_table__create_problem(specs, c,
+				TEST_SOLVER_TABLE_VARIABLES, TEST_SOLVER_TABLE_DOMAIN
+			);
+			uint64_t expected = test_solver_table__brute_force(specs, c,
+				TEST_SOLVER_TABLE_DOMAIN
+			);
+
+			for(size_t t = 0; t < solve_types_count; t++){
+				assert(csp_problem_count_solutions(problem, NULL, solve_types[t],
+					NULL
+				) == expected);
+			}
+			test_solver_utils__destroy(problem);
+		}
+
+		// Tables of several words, whose current tables MAC narrows along the
+		// branches and restores on backtrack, across restarts and assumptions
+		const TestSolverTableSpec wide[TEST_SOLVER_TABLE_CONSTRAINTS] = {
+			{2, {0, 1}, true, test_solver_table__less},
+			{2, {1, 2}, true, test_solver_table__less},
+			{3, {0, 2, 3}, false, test_solver_table__same},
+			{2, {3, 4}, false, test_solver_table__equal}
+		};
+		CSPProblem *problem = test_solver_table__create_problem(wide,
+			TEST_SOLVER_TABLE_CONSTRAINTS, TEST_SOLVER_TABLE_VARIABLES,
+			TEST_SOLVER_TABLE_WIDE_DOMAIN
+		);
+		const CSPConstraint *table = csp_problem_get_constraint(problem, 0);
+		uint64_t expected = test_solver_table__brute_force(wide,
+			TEST_SOLVER_TABLE_CONSTRAINTS, TEST_SOLVER_TABLE_WIDE_DOMAIN
+		);
+		assert(csp_constraint_get_table_words(table) == 2);
+
+		for(size_t t = 0; t < solve_types_count; t++){
+			assert(csp_problem_count_solutions(problem, NULL, solve_types[t],
+				NULL
+			) == expected);
+		}
+
+		size_t values[TEST_SOLVER_TABLE_VARIABLES];
+		CSPSolver *solver = csp_solver_create(problem);
+		assert(solver != NULL);
+		csp_solver_set_restarts(solver, RESTARTS_LUBY, 1, 0.0);
+		assert(csp_solver_solve(solver, values, NULL, MAC | OVARS_DOMWDEG, NULL,
+			NULL, NULL
+		));
+		for(size_t c = 0; c < TEST_SOLVER_TABLE_CONSTRAINTS; c++){
+			size_t tuple[3];
+			for(size_t i = 0; i < wide[c].arity; i++){
+				tuple[i] = values[wide[c].variables[i]];
+			}
+			assert(wide[c].predicate(tuple) == wide[c].allowed);
+		}
+
+		csp_solver_set_restarts(solver, RESTARTS_NONE, 1, 0.0);
+		csp_solver_set_incremental(solver, true);
+		uint64_t sum = 0;
+		for(size_t v = 0; v < TEST_SOLVER_TABLE_WIDE_DOMAIN; v++){
+			assert(csp_solver_assume(solver, 0, v));
+			sum += csp_solver_enumerate(solver, values, NULL, MAC, NULL, NULL,
+				NULL, NULL, NULL
+			);
+			csp_solver_retract(solver);
+		}
+		assert(sum == expected);
+		csp_solver_destroy(solver);
+		test_solver_utils__destroy(problem);
+
+		// The check function of empty tables
+		CSPConstraint *none = csp_constraint_create_table(2, NULL, 0, true);
+		CSPConstraint *any = csp_constraint_create_table(2, NULL, 0, false);
+		assert(none != NULL && any != NULL);
+		assert(csp_constraint_is_table(none));
+		assert(!csp_constraint_get_check(none)(none, values, NULL));
+		assert(csp_constraint_get_check(any)(any, values, NULL));
+		csp_constraint_destroy(none);
+		csp_constraint_destroy(any);
+
+		// The tuples of a table are indexed by variable and value
+		const TestSolverTableSpec same = {3, {0, 1, 2}, true,
+			test_solver_table__same
+		};
+		problem = test_solver_table__create_problem(&same, 1, 3, 3);
+		table = csp_problem_get_constraint(problem, 0);
+		assert(csp_constraint_get_table_allowed(table));
+		assert(csp_constraint_get_table_words(table) == 1);
+		assert(*csp_constraint_get_table_supports(table, 1, 2) == 4);
+		assert(csp_constraint_get_table_supports(table, 1, 3) == NULL);
+
+		// MAC keeps every value in a tuple of values left, so that a single
+		// table is solved without failing, where forward checking waits for
+		// all the variables but one to be filled
+		CSPSolveStats stats;
+		assert(csp_problem_count_solutions(problem, NULL, MAC, &stats) == 3);
+#ifdef CSP_STATS
+		assert(stats.wipeouts == 0);
+		assert(csp_problem_count_solutions(problem, NULL, FC, &stats) == 3);
+		assert(stats.wipeouts > 0);
+#endif
+		test_solver_utils__destroy(problem);
+	}
+	// Finish the library
+	csp_finish();
+
+	return EXIT_SUCCESS;
+}
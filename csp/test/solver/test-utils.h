@@ -0,0 +1,177 @@
+/**
+ * @file test-utils.h
+ * Defines the problems shared by the solver tests.
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <assert.h>
+
+#include "csp.h"
+#include "util/unused.h"
+
+/**
+ * @brief Check that two queens attack each other neither on a row nor on a
+ * diagonal, the variables being their columns and the values their rows.
+ * @param constraint The constraint of the pair of queens.
+ * @param values The values of the variables.
+ * @param data Unused.
+ * @return true if the queens do not attack each other, false otherwise.
+ */
+static inline bool test_solver_utils__queens_check(
+	const CSPConstraint *constraint, const size_t *values,
+	const void *UNUSED_VAR(data)
+){
+	size_t x0 = csp_constraint_get_variable(constraint, 0);
+	size_t x1 = csp_constraint_get_variable(constraint, 1);
+	size_t y0 = values[x0];
+	size_t y1 = values[x1];
+
+	return y0 != y1 && x0 + y1 != x1 + y0 && x0 + y0 != x1 + y1;
+}
+
+/**
+ * @brief Create the constraint of a pair of queens.
+ * @param x The column of the first queen.
+ * @param y The column of the second queen.
+ * @return The constraint, NULL if an error occurred.
+ */
+static inline CSPConstraint *test_solver_utils__queens(size_t x, size_t y){
+	CSPConstraint *constraint = csp_constraint_create(2,
+		test_solver_utils__queens_check
+	);
+	if(constraint != NULL){
+		csp_constraint_set_variable(constraint, 0, x);
+		csp_constraint_set_variable(constraint, 1, y);
+	}
+	return constraint;
+}
+
+/**
+ * @brief Check that two variables take different values.
+ * @param constraint The constraint of the pair of variables.
+ * @param values The values of the variables.
+ * @param data Unused.
+ * @return true if the values differ, false otherwise.
+ */
+static inline bool test_solver_utils__not_equal_check(
+	const CSPConstraint *constraint, const size_t *values,
+	const void *UNUSED_VAR(data)
+){
+	return values[csp_constraint_get_variable(constraint, 0)]
+		!= values[csp_constraint_get_variable(constraint, 1)];
+}
+
+/**
+ * @brief Create the constraint of two variables taking different values.
+ * @param x The first variable.
+ * @param y The second variable.
+ * @return The constraint, NULL if an error occurred.
+ */
+static inline CSPConstraint *test_solver_utils__not_equal(size_t x, size_t y){
+	CSPConstraint *constraint = csp_constraint_create(2,
+		test_solver_utils__not_equal_check
+	);
+	if(constraint != NULL){
+		csp_constraint_set_variable(constraint, 0, x);
+		csp_constraint_set_variable(constraint, 1, y);
+	}
+	return constraint;
+}
+
+/**
+ * @brief Create n variables of a domain, pairwise constrained, followed by
+ * room for extra constraints.
+ * @param n The number of variables.
+ * @param domain The domain of the variables.
+ * @param extra The number of constraints left to set after the pairs.
+ * @param create The constructor of the constraint of a pair of variables.
+ * @return The CSP problem, not finalised.
+ */
+static inline CSPProblem *test_solver_utils__pairwise(size_t n, size_t domain,
+	size_t extra, CSPConstraint *(*create)(size_t x, size_t y)
+){
+	CSPProblem *problem = csp_problem_create(n, n * (n - 1) / 2 + extra);
+	assert(problem != NULL);
+
+	size_t index = 0;
+	for(size_t i = 0; i < n; i++){
+		csp_problem_set_domain(problem, i, domain);
+
+		for(size_t j = i + 1; j < n; j++){
+			CSPConstraint *constraint = create(i, j);
+			assert(constraint != NULL);
+
+			csp_problem_set_constraint(problem, index++, constraint);
+		}
+	}
+
+	return problem;
+}
+
+/**
+ * @brief Create n variables of a domain, pairwise constrained.
+ * @param n The number of variables.
+ * @param domain The domain of the variables.
+ * @param create The constructor of the constraint of a pair of variables.
+ * @return The finalised CSP problem.
+ */
+static inline CSPProblem *test_solver_utils__create(size_t n, size_t domain,
+	CSPConstraint *(*create)(size_t x, size_t y)
+){
+	CSPProblem *problem = test_solver_utils__pairwise(n, domain, 0, create);
+	assert(csp_problem_finalise(problem));
+
+	return problem;
+}
+
+/**
+ * @brief Create the n-queens problem, a variable per column whose value is the
+ * row of its queen, from the built-in queens constraint.
+ * @param n The number of queens.
+ * @return The finalised CSP problem.
+ */
+static inline CSPProblem *test_solver_utils__create_queens(size_t n){
+	return test_solver_utils__create(n, n, csp_constraint_create_queens);
+}
+
+/**
+ * @brief Destroy a CSP problem and its constraints.
+ * @param problem The CSP problem.
+ */
+static inline void test_solver_utils__destroy(CSPProblem *problem){
+	for(size_t i = 0; i < csp_problem_get_num_constraints(problem); i++){
+		csp_constraint_destroy(csp_problem_get_constraint(problem, i));
+	}
+	csp_problem_destroy(problem);
+}
+
+/**
+ * @brief Verify that the rows of n queens are a solution of the n-queens
+ * problem.
+ * @param n The number of queens.
+ * @param queens The rows of the queens.
+ * @return true if no queen attacks another one, false otherwise.
+ */
+static inline bool test_solver_utils__valid_queens(size_t n,
+	const size_t *queens
+){
+	for(size_t i = 0; i < n; i++){
+		if(queens[i] >= n){
+			return false;
+		}
+		for(size_t j = i + 1; j < n; j++){
+			if(queens[i] == queens[j]
+				|| queens[i] + j == queens[j] + i || queens[i] + i == queens[j] + j
+			){
+				return false;
+			}
+		}
+	}
+	return true;
+}
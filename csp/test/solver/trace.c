@@ -0,0 +1,134 @@
+/**
+ * @file trace.h
+ *
+ * @author Xibitol <xibitol@pimous.dev>
+ * @date 2025
+ */
+
+#ifdef NDEBUG
+	#undef NDEBUG
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "csp.h"
+#include "test-utils.h"
+
+#define TEST_SOLVER_TRACE_FILE "trace.json"
+
+// Replay the assignments of the events, which must undo them in reverse order
+static void test_solver_trace__replay(const CSPTraceBuffer *buffer, size_t n,
+	const size_t *queens
+){
+	size_t assigned[8];
+	size_t depth = 0;
+	double time = 0.0;
+
+	for(size_t i = 0; i < csp_trace_buffer_get_count(buffer); i++){
+		const CSPTraceEvent *event = csp_trace_buffer_get_event(buffer, i);
+		assert(event->time >= time);
+		time = event->time;
+
+		switch(event->type){
+			case TRACE_ASSIGN:
+				assert(event->depth == depth + 1);
+				assert(event->variable < n && event->value < n);
+				assigned[depth++] = event->variable;
+				break;
+			case TRACE_UNASSIGN:
+				assert(depth > 0 && event->depth == depth);
+				assert(assigned[--depth] == event->variable);
+				break;
+			case TRACE_PRUNE:
+				assert(event->depth == depth && event->variable < n);
+				assert(event->value < n);
+				break;
+			case TRACE_WIPEOUT:
+				assert(event->depth == depth);
+				break;
+			case TRACE_SOLUTION:
+				assert(i + 1 == csp_trace_buffer_get_count(buffer));
+				assert(event->depth == n && depth == n);
+				break;
+		}
+	}
+	for(size_t i = 0; i < depth; i++){
+		assert(queens[assigned[i]] < n);
+	}
+}
+
+int test_solver_trace(void){
+	const SolveType solve_types[] = {
+		0, FC, FC | OVARS_MIN, MAC, FC | CBJ, MAC | CBJ, FC | OVARS_DOMWDEG
+	};
+	const size_t solve_types_count = sizeof(solve_types) / sizeof(SolveType);
+
+	// Initialise the library
+	csp_init();
+	{
+		CSPProblem *problem = test_solver_utils__create_queens(8);
+		CSPSolver *solver = csp_solver_create(problem);
+		CSPTraceBuffer *buffer = csp_trace_buffer_create(1 << 16);
+		size_t queens[8];
+		assert(solver != NULL && buffer != NULL);
+
+		// Every event of the search is received, up to the solution
+		csp_solver_set_trace(solver, csp_trace_buffer_record, buffer);
+		for(size_t t = 0; t < solve_types_count; t++){
+			csp_trace_buffer_clear(buffer);
+			assert(csp_solver_solve(solver, queens, NULL, solve_types[t], NULL,
+				NULL, NULL
+			));
+			assert(csp_trace_buffer_get_dropped(buffer) == 0);
+			assert(csp_trace_buffer_get_count(buffer) > 8);
+			test_solver_trace__replay(buffer, 8, queens);
+		}
+
+		// The restarts undo every decision
+		csp_solver_set_restarts(solver, RESTARTS_LUBY, 1, 0.0);
+		csp_trace_buffer_clear(buffer);
+		assert(csp_solver_solve(solver, queens, NULL, FC, NULL, NULL, NULL));
+		assert(csp_solver_get_restarts(solver) > 0);
+		test_solver_trace__replay(buffer, 8, queens);
+		csp_solver_set_restarts(solver, RESTARTS_NONE, 0, 0.0);
+
+		// A full ring buffer keeps the last events
+		csp_trace_buffer_destroy(buffer);
+		buffer = csp_trace_buffer_create(4);
+		assert(buffer != NULL);
+		csp_solver_set_trace(solver, csp_trace_buffer_record, buffer);
+		assert(csp_solver_solve(solver, queens, NULL, FC, NULL, NULL, NULL));
+		assert(csp_trace_buffer_get_count(buffer) == 4);
+		assert(csp_trace_buffer_get_dropped(buffer) > 0);
+		assert(csp_trace_buffer_get_event(buffer, 3)->type == TRACE_SOLUTION);
+
+		// The Chrome trace is a JSON object of events
+		assert(csp_trace_buffer_write_chrome(buffer, TEST_SOLVER_TRACE_FILE));
+		FILE *file = fopen(TEST_SOLVER_TRACE_FILE, "r");
+		assert(file != NULL);
+		char head[16] = {0};
+		assert(fread(head, 1, sizeof(head) - 1, file) == sizeof(head) - 1);
+		assert(strcmp(head, "{\"traceEvents\":") == 0);
+		fclose(file);
+		assert(remove(TEST_SOLVER_TRACE_FILE) == 0);
+
+		// Without a hook, nothing is recorded
+		csp_trace_buffer_clear(buffer);
+		csp_solver_set_trace(solver, NULL, NULL);
+		assert(csp_solver_solve(solver, queens, NULL, FC, NULL, NULL, NULL));
+		assert(csp_trace_buffer_get_count(buffer) == 0);
+
+		csp_trace_buffer_destroy(buffer);
+		csp_solver_destroy(solver);
+		test_solver_utils__destroy(problem);
+	}
+	// Finish the library
+	csp_finish();
+
+	return EXIT_SUCCESS;
+}